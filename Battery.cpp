@@ -0,0 +1,82 @@
+#include "Battery.h"
+#include "Log.h"
+#include <atomic>
+
+#define BATTERY_BURST  8   // Samples per tick; min and max are discarded
+
+/**
+ * Single-cell LiPo resting voltage vs state of charge
+ * Linear interpolation between points; the knee below ~3.7V is steep.
+ */
+struct LipoPoint { uint16_t mv; uint8_t percent; };
+static const LipoPoint lipo_curve[] = {
+    {3270,   0}, {3610,   5}, {3690,  10}, {3710,  15}, {3730,  20},
+    {3750,  25}, {3770,  30}, {3790,  35}, {3800,  40}, {3820,  45},
+    {3840,  50}, {3850,  55}, {3870,  60}, {3910,  65}, {3950,  70},
+    {3980,  75}, {4020,  80}, {4080,  85}, {4110,  90}, {4150,  95},
+    {4200, 100},
+};
+
+// Latest reading packed in one word: valid(1) | percent+1 (8) | mv (16)
+static std::atomic<uint32_t> battery_state(0);
+
+static int Battery_Percent(uint16_t mv) {
+    const int n = sizeof lipo_curve / sizeof lipo_curve[0];
+    if (mv <= lipo_curve[0].mv) return 0;
+    if (mv >= lipo_curve[n - 1].mv) return 100;
+    int i = 1;
+    while (mv > lipo_curve[i].mv) i++;
+    const LipoPoint &lo = lipo_curve[i - 1], &hi = lipo_curve[i];
+    return lo.percent + (int)(mv - lo.mv) * (hi.percent - lo.percent) / (hi.mv - lo.mv);
+}
+
+// Trimmed mean of a burst, in battery millivolts
+static uint32_t Battery_SampleMv(void) {
+    uint32_t sum = 0, lo = UINT32_MAX, hi = 0;
+    for (int i = 0; i < BATTERY_BURST; i++) {
+        // analogReadMilliVolts applies the eFuse Vref / two-point calibration
+        uint32_t v = analogReadMilliVolts(BATTERY_PIN);
+        sum += v;
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    return (sum - lo - hi) / (BATTERY_BURST - 2) * 2;  // Undo the VBAT/2 divider
+}
+
+static void Battery_Task(void *) {
+    uint32_t filtered = 0;
+    for (;;) {
+        uint32_t mv = Battery_SampleMv();
+
+        // Exponential moving average (1/4), reset on plug/unplug jumps
+        if (!filtered || mv < BATTERY_NONE_MV || (mv > filtered ? mv - filtered : filtered - mv) > 300) {
+            filtered = mv;
+        } else {
+            filtered += ((int32_t)mv - (int32_t)filtered) / 4;
+        }
+
+        const bool present = filtered >= BATTERY_NONE_MV;
+        const int percent = present ? Battery_Percent(filtered) : -1;
+        battery_state.store(1u << 24 | (uint32_t)(percent + 1) << 16 | (filtered & 0xFFFF),
+                            std::memory_order_release);
+        LOG_D(EV_BATTERY, filtered, percent);
+
+        vTaskDelay(pdMS_TO_TICKS(BATTERY_SAMPLE_MS));
+    }
+}
+
+void Battery_Begin(void) {
+    analogReadResolution(12);
+    analogSetPinAttenuation(BATTERY_PIN, ADC_11db);  // Full 0-3.3V range
+    xTaskCreatePinnedToCore(Battery_Task, "battery", 2048, NULL, tskIDLE_PRIORITY + 1, NULL, 0);
+}
+
+BatteryReading Battery_Get(void) {
+    const uint32_t s = battery_state.load(std::memory_order_acquire);
+    BatteryReading r;
+    r.valid   = (s >> 24) & 1;
+    r.mv      = s & 0xFFFF;
+    r.percent = (int8_t)(((s >> 16) & 0xFF) - 1);
+    r.present = r.valid && r.percent >= 0;
+    return r;
+}
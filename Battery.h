@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Background battery monitor for HUZZAH32 Feather
+ *
+ * The HUZZAH32 includes a voltage divider on pin A13 (GPIO35) that reads
+ * half the battery voltage. A low-priority task samples it periodically
+ * through the eFuse-calibrated ADC path, filters the result and maps it to
+ * state of charge with a LiPo discharge curve. Consumers only ever read the
+ * cached value, so the boot and frame paths never wait on the ADC.
+ */
+
+#define BATTERY_PIN        A13     // GPIO35, VBAT/2
+#define BATTERY_SAMPLE_MS  5000    // Voltage moves slowly; keep wakeups rare
+#define BATTERY_NONE_MV    500     // Below this: no battery (USB power only)
+
+struct BatteryReading {
+    bool     valid;    // At least one sample taken
+    bool     present;  // Battery connected
+    uint16_t mv;       // Filtered battery voltage
+    int8_t   percent;  // State of charge 0-100, -1 without battery
+};
+
+// Start the sampling task; the first reading is available within milliseconds
+void Battery_Begin(void);
+
+// Latest filtered reading; never blocks
+BatteryReading Battery_Get(void);
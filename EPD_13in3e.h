@@ -31,6 +31,7 @@
 #define _EPD_13IN3E_H_
 
 #include "DEV_Config.h"
+#include "EPD_Driver.h"
 
 // M/S 控制区域 600*1600
 #define EPD_13IN3E_WIDTH        1200
@@ -44,28 +45,8 @@
 #define EPD_13IN3E_BLUE         0x5
 #define EPD_13IN3E_GREEN        0x6
 
-#define PSR             0x00
-#define PWR_epd         0x01
-#define POF             0x02
-#define PON             0x04
-#define BTST_N          0x05
-#define BTST_P          0x06
-#define DTM             0x10
-#define DRF             0x12
-#define CDI             0x50
-#define TCON            0x60
-#define TRES            0x61
-#define AN_TM           0x74
-#define AGID            0x86
-#define BUCK_BOOST_VDDN 0xB0
-#define TFT_VCOM_POWER  0xB1
-#define EN_BUF          0xB6
-#define BOOST_VDDP_EN   0xB7
-#define CCSET           0xE0
-#define PWS             0xE3
-#define CMD66           0xF0
-
-
+// Driver instance for this panel; the C API below forwards to it
+typedef EPD_Driver<EPD_13IN3E_Panel> EPD_13IN3E;
 
 
 void EPD_13IN3E_Init(void);
@@ -78,7 +59,7 @@ void EPD_13IN3E_Sleep(void);
 
 // --- Streaming helpers for external code ---
 void EPD_13IN3E_BeginFrameM(void);            // select left (M), send DTM
-void EPD_13IN3E_WriteLineM(const UBYTE *p300);// write 300 bytes (one line)
+void EPD_13IN3E_WriteLineM(const UBYTE *p300);// write EPD_13IN3E::LINE_BYTES (one line)
 void EPD_13IN3E_EndFrameM(void);              // deassert CS
 
 void EPD_13IN3E_BeginFrameS(void);            // select right (S), send DTM
@@ -88,8 +69,8 @@ void EPD_13IN3E_EndFrameS(void);
 void EPD_13IN3E_RefreshNow(void);             // PON -> DRF -> POF
 
 // Boot Splash Screen with Text Rendering
-void EPD_13IN3E_ShowBootSplash(const char* ssid, uint16_t port, int battery_pct);  // Show boot splash with WiFi info and battery level
-void EPD_13IN3E_DisplayTextScreen(const char* ssid, uint16_t port, int battery_pct);     // Bitmap text rendering with better font quality
+void EPD_13IN3E_ShowBootSplash(const char* ssid, uint16_t port, int battery_pct, uint16_t battery_mv);  // Show boot splash with WiFi info and battery level
+void EPD_13IN3E_DisplayTextScreen(const char* ssid, uint16_t port, int battery_pct, uint16_t battery_mv);     // Bitmap text rendering with better font quality
 
 // Enhanced Power Management Functions
 void EPD_13IN3E_PowerOn(void);               // Power on sequence with proper timing
@@ -0,0 +1,311 @@
+#pragma once
+#include <WiFi.h>
+#include "DEV_Config.h"
+#include "Log.h"
+#include "EPD_Panel.h"
+#include "Font8x8.h"
+
+/**
+ * Panel-generic e-Paper driver
+ *
+ * Instantiated on a descriptor from EPD_Panel.h. Every geometry and pixel
+ * format value is a compile-time constant, so the per-line streaming path
+ * compiles down to the same straight SPI writes as a hand-written driver
+ * for that panel, with no runtime dispatch.
+ *
+ * Frame data is sent one controller at a time: controller 0 (Master) owns
+ * the leftmost CTRL_WIDTH columns, controller 1 (Slave) the next ones.
+ */
+template <class Panel>
+class EPD_Driver {
+public:
+    static constexpr UWORD WIDTH           = Panel::WIDTH;
+    static constexpr UWORD HEIGHT          = Panel::HEIGHT;
+    static constexpr UBYTE CONTROLLERS     = Panel::CONTROLLERS;
+    static constexpr UBYTE BITS_PER_PIXEL  = Panel::BITS_PER_PIXEL;
+    static constexpr UWORD CTRL_WIDTH      = WIDTH / CONTROLLERS;
+    static constexpr UBYTE PIXELS_PER_BYTE = 8 / BITS_PER_PIXEL;
+    static constexpr UWORD LINE_BYTES      = CTRL_WIDTH / PIXELS_PER_BYTE;  // Per controller
+    static constexpr UDOUBLE FRAME_BYTES   = (UDOUBLE)LINE_BYTES * HEIGHT * CONTROLLERS;
+
+    static_assert(CONTROLLERS == 1 || CONTROLLERS == 2, "Panel must have one or two controllers");
+    static_assert(WIDTH % CONTROLLERS == 0, "Panel width must split evenly between controllers");
+    static_assert(8 % BITS_PER_PIXEL == 0, "Pixels must not straddle bytes");
+    static_assert(CTRL_WIDTH % PIXELS_PER_BYTE == 0, "Controller width must fill whole bytes");
+
+    /**
+     * Color code replicated into every pixel slot of a byte
+     * (e.g. 0x11 for white at 4 bpp)
+     */
+    static constexpr UBYTE Fill(UBYTE color) {
+        return Replicate(color & PIXEL_MASK, PIXELS_PER_BYTE);
+    }
+
+    /**
+     * Set pixel x (0..CTRL_WIDTH-1) of a controller line buffer
+     * Leftmost pixel sits in the most significant bits of its byte.
+     */
+    static inline void SetPixel(UBYTE *line, UWORD x, UBYTE color) {
+        const UBYTE shift = (PIXELS_PER_BYTE - 1 - (x % PIXELS_PER_BYTE)) * BITS_PER_PIXEL;
+        UBYTE &b = line[x / PIXELS_PER_BYTE];
+        b = (b & ~(PIXEL_MASK << shift)) | ((color & PIXEL_MASK) << shift);
+    }
+
+    static void Init(void) {
+        Reset();
+        if (Panel::BUSY_AFTER_RESET) {
+            ReadBusyH();
+            DEV_Delay_ms(30);
+        }
+        SendTable(Panel::INIT, Panel::INIT_COUNT);
+    }
+
+    static void Clear(UBYTE color) {
+        const UBYTE packed = Fill(color);
+        for (UBYTE ctrl = 0; ctrl < CONTROLLERS; ctrl++) {
+            BeginFrame(ctrl);
+            for (UWORD y = 0; y < HEIGHT; y++) {
+                for (UWORD i = 0; i < LINE_BYTES; i++) {
+                    DEV_SPI_WriteByte(packed);
+                }
+                DEV_Delay_ms(1);
+            }
+            EndFrame();
+        }
+        Refresh();
+    }
+
+    static void Sleep(void) {
+        Select(EPD_CTRL_ALL);
+        SendCommand(0x07);
+        DEV_SPI_WriteByte(0xA5);
+        Select(0);
+        DEV_Delay_ms(100);
+    }
+
+    // --- Streaming: one controller at a time, LINE_BYTES per line ---
+    static void BeginFrame(UBYTE ctrl) {
+        // Ensure the other controller is deselected first
+        Select(0);
+        Select(ctrl == 0 ? EPD_CTRL_M : EPD_CTRL_S);
+        SendCommand(DTM);
+    }
+
+    static inline void WriteLine(const UBYTE *line) {
+        DEV_SPI_Write_nByte((UBYTE *)line, LINE_BYTES);
+    }
+
+    static void EndFrame(void) {
+        Select(0);
+    }
+
+    // PON -> DRF -> POF
+    static void Refresh(void) {
+        const unsigned long t0 = millis();
+        LOG_D(EV_EPD_PON);
+        Select(EPD_CTRL_ALL);
+        SendCommand(PON);
+        Select(0);
+        ReadBusyH();
+
+        LOG_D(EV_EPD_DRF);
+        DEV_Delay_ms(50);
+        SendTable(Panel::PRE_DRF, Panel::PRE_DRF_COUNT);
+        Select(EPD_CTRL_ALL);
+        SendCommand(DRF);
+        DEV_SPI_WriteByte(0x00);
+        Select(0);
+        ReadBusyH();
+
+        LOG_D(EV_EPD_POF);
+        Select(EPD_CTRL_ALL);
+        SendCommand(POF);
+        DEV_SPI_WriteByte(0x00);
+        Select(0);
+        // The 13.3" reference does not wait for busy after POF - timing sensitive
+        if (Panel::POF_WAIT_BUSY) ReadBusyH();
+        LOG_I(EV_EPD_REFRESH_DONE, millis() - t0);
+    }
+
+    /**
+     * Boot splash: six color bands, each with one line of 4x scaled text
+     * Text is laid out in full-panel coordinates and clipped per controller,
+     * so it continues seamlessly across the Master/Slave boundary.
+     * The panel must be Init()ed. Setting *cancel aborts before the next
+     * line; a refresh already started always completes.
+     *
+     * @return true if the splash reached the glass
+     */
+    static bool DisplayTextScreen(const char* ssid, uint16_t port, int battery_pct, uint16_t battery_mv,
+                                  volatile bool* cancel = NULL) {
+        LOG_I(EV_SPLASH_START);
+
+        static UBYTE line[LINE_BYTES];
+
+        // Get WiFi info for display - convert to uppercase for better font rendering
+        String ip_line;
+        String wifi_line;
+        String battery_line;
+        if (battery_pct < 0) {
+            battery_line = "USB POWER";
+        } else {
+            battery_line = "BATTERY: " + String(battery_mv / 1000.0, 1) + "V (" + String(battery_pct) + "%)";
+        }
+
+        if (WiFi.status() == WL_CONNECTED) {
+            ip_line = "IP: " + WiFi.localIP().toString() + " PORT: " + String(port);
+            String ssid_upper = String(ssid);
+            ssid_upper.toUpperCase();
+            wifi_line = "WIFI: " + ssid_upper;
+        } else {
+            ip_line = "NO WIFI CONNECTION";
+            wifi_line = "OFFLINE MODE";
+        }
+
+        // At 40px per char, WIDTH/40 characters fit (30 on the 13.3")
+        const char* band_texts[BANDS] = {
+            "E-INK FRAME (C) 2025",
+            ip_line.c_str(),
+            wifi_line.c_str(),
+            battery_line.c_str(),
+            Panel::NAME,
+            "READY FOR YOUR IMAGES"
+        };
+
+        for (UBYTE ctrl = 0; ctrl < CONTROLLERS; ctrl++) {
+            const int x0 = ctrl * CTRL_WIDTH;  // First full-panel column of this controller
+            BeginFrame(ctrl);
+
+            for (int y = 0; y < HEIGHT; y++) {
+                if (cancel && *cancel) {
+                    EndFrame();
+                    LOG_I(EV_SPLASH_CANCELLED, "MS"[ctrl], y);
+                    return false;
+                }
+
+                int band_index = y / BAND_HEIGHT;
+                if (band_index > BANDS - 1) band_index = BANDS - 1;
+                const UBYTE band_color = BandColor(band_index);
+
+                // Start with band background color
+                memset(line, Fill(band_color), LINE_BYTES);
+
+                // Add large text in the middle of each band
+                int scaled_font_y = (y % BAND_HEIGHT - TEXT_TOP) / FONT_SCALE;
+                if (y % BAND_HEIGHT >= TEXT_TOP && scaled_font_y < 8) {
+                    const UBYTE text_color = TextColor(band_color);
+                    int text_x = TEXT_LEFT;
+                    for (const char* p = band_texts[band_index]; *p && text_x < x0 + CTRL_WIDTH; p++) {
+                        if (*p < 32 || *p > 126) continue;
+                        const uint8_t line_data = font8x8_basic[*p - 32][scaled_font_y];
+                        for (int bit = 0; bit < 8; bit++) {
+                            if (!(line_data & (0x80 >> bit))) continue;
+                            for (int scale_x = 0; scale_x < FONT_SCALE; scale_x++) {
+                                int pixel_x = text_x + bit * FONT_SCALE + scale_x - x0;
+                                if (pixel_x >= 0 && pixel_x < CTRL_WIDTH) {
+                                    SetPixel(line, pixel_x, text_color);
+                                }
+                            }
+                        }
+                        text_x += CHAR_PITCH;
+                    }
+                }
+
+                WriteLine(line);
+
+                if ((y % 100) == 0) {
+                    LOG_D(EV_LINE, "MS"[ctrl], y, HEIGHT);
+                }
+            }
+            EndFrame();
+        }
+
+        Refresh();
+
+        LOG_I(EV_SPLASH_DONE);
+        return true;
+    }
+
+private:
+    static constexpr UBYTE PIXEL_MASK  = (1 << BITS_PER_PIXEL) - 1;
+
+    // Splash layout
+    static constexpr int BANDS       = 6;
+    static constexpr int BAND_HEIGHT = HEIGHT / BANDS;
+    static constexpr int FONT_SCALE  = 4;
+    static constexpr int CHAR_PITCH  = 8 * FONT_SCALE + 8;
+    static constexpr int TEXT_TOP    = (BAND_HEIGHT - 16 * FONT_SCALE) / 2;
+    static constexpr int TEXT_LEFT   = 20;
+
+    static constexpr UBYTE Replicate(UBYTE v, UBYTE n) {
+        return n == 1 ? v : (UBYTE)((Replicate(v, n - 1) << BITS_PER_PIXEL) | v);
+    }
+
+    static UBYTE BandColor(int band) {
+        switch (band) {
+            case 0:  return Panel::BLACK;
+            case 1:  return Panel::WHITE;
+            case 2:  return Panel::YELLOW;
+            case 3:  return Panel::RED;
+            case 4:  return Panel::BLUE;
+            default: return Panel::GREEN;
+        }
+    }
+
+    // Contrasting text color for a band
+    static UBYTE TextColor(UBYTE band_color) {
+        if (band_color == Panel::WHITE || band_color == Panel::YELLOW) return Panel::BLACK;
+        return Panel::WHITE;
+    }
+
+    // CS is active low; mask 0 deselects every controller
+    static inline void Select(UBYTE mask) {
+        DEV_Digital_Write(EPD_CS_M_PIN, (mask & EPD_CTRL_M) ? 0 : 1);
+        if (CONTROLLERS > 1) {
+            DEV_Digital_Write(EPD_CS_S_PIN, (mask & EPD_CTRL_S) ? 0 : 1);
+        }
+    }
+
+    static void Reset(void) {
+        // RESET_PULSES low pulses; the 13.3" reference pulses twice to reset both controllers
+        DEV_Digital_Write(EPD_RST_PIN, 1);
+        DEV_Delay_ms(30);
+        for (UBYTE i = 0; i < Panel::RESET_PULSES; i++) {
+            DEV_Digital_Write(EPD_RST_PIN, 0);
+            DEV_Delay_ms(30);
+            DEV_Digital_Write(EPD_RST_PIN, 1);
+            DEV_Delay_ms(30);
+        }
+    }
+
+    static void SendTable(const EPD_InitCmd *table, UBYTE count) {
+        for (UBYTE i = 0; i < count; i++) {
+            const EPD_InitCmd &c = table[i];
+            Select(c.ctrl);
+            SendCommand(c.cmd);
+            SendData(c.data, c.len);
+            Select(0);
+        }
+    }
+
+    static void SendCommand(UBYTE Reg) {
+        if (Panel::USES_DC) DEV_Digital_Write(EPD_DC_PIN, 0);
+        DEV_SPI_WriteByte(Reg);
+        if (Panel::USES_DC) DEV_Digital_Write(EPD_DC_PIN, 1);
+    }
+
+    static void SendData(const UBYTE *buf, UDOUBLE Len) {
+        if (!buf || Len == 0) return;
+        DEV_SPI_Write_nByte((UBYTE *)buf, Len);
+    }
+
+    static void ReadBusyH(void) {
+        LOG_D(EV_EPD_BUSY);
+        const unsigned long t0 = millis();
+        while(!DEV_Digital_Read(EPD_BUSY_PIN)) {
+            DEV_Delay_ms(10);
+        }
+        DEV_Delay_ms(20);
+        LOG_I(EV_EPD_BUSY_RELEASE, millis() - t0);
+    }
+};
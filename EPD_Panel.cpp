@@ -0,0 +1,50 @@
+#include "EPD_Panel.h"
+
+// C++11: out-of-line definitions for the constexpr members that get odr-used
+constexpr const char* EPD_13IN3E_Panel::NAME;
+constexpr const char* EPD_7IN3E_Panel::NAME;
+
+// Init sequence from the Waveshare 13.3" (E) reference driver
+const EPD_InitCmd EPD_13IN3E_Panel::INIT[EPD_13IN3E_Panel::INIT_COUNT] = {
+    { EPD_CTRL_M,   AN_TM,           9, {0xC0, 0x1C, 0x1C, 0xCC, 0xCC, 0xCC, 0x15, 0x15, 0x55} },
+    { EPD_CTRL_ALL, CMD66,           6, {0x49, 0x55, 0x13, 0x5D, 0x05, 0x10} },
+    { EPD_CTRL_ALL, PSR,             2, {0xDF, 0x69} },
+    { EPD_CTRL_ALL, CDI,             1, {0xF7} },
+    { EPD_CTRL_ALL, TCON,            2, {0x03, 0x03} },
+    { EPD_CTRL_ALL, AGID,            1, {0x10} },
+    { EPD_CTRL_ALL, PWS,             1, {0x22} },
+    { EPD_CTRL_ALL, CCSET,           1, {0x01} },
+    { EPD_CTRL_ALL, TRES,            4, {0x04, 0xB0, 0x03, 0x20} },
+    { EPD_CTRL_M,   PWR_epd,         6, {0x0F, 0x00, 0x28, 0x2C, 0x28, 0x38} },
+    { EPD_CTRL_M,   EN_BUF,          1, {0x07} },
+    { EPD_CTRL_M,   BTST_P,          2, {0xE8, 0x28} },
+    { EPD_CTRL_M,   BOOST_VDDP_EN,   1, {0x01} },
+    { EPD_CTRL_M,   BTST_N,          2, {0xE8, 0x28} },
+    { EPD_CTRL_M,   BUCK_BOOST_VDDN, 1, {0x01} },
+    { EPD_CTRL_M,   TFT_VCOM_POWER,  1, {0x02} },
+};
+
+const EPD_InitCmd* const EPD_13IN3E_Panel::PRE_DRF = NULL;
+
+// Init sequence from the Waveshare 7.3" (E) reference driver
+const EPD_InitCmd EPD_7IN3E_Panel::INIT[EPD_7IN3E_Panel::INIT_COUNT] = {
+    { EPD_CTRL_M, 0xAA,    6, {0x49, 0x55, 0x20, 0x08, 0x09, 0x18} },  // CMDH
+    { EPD_CTRL_M, PWR_epd, 1, {0x3F} },
+    { EPD_CTRL_M, PSR,     2, {0x5F, 0x69} },
+    { EPD_CTRL_M, 0x03,    4, {0x00, 0x54, 0x00, 0x44} },              // POFS
+    { EPD_CTRL_M, BTST_N,  4, {0x40, 0x1F, 0x1F, 0x2C} },              // BTST1
+    { EPD_CTRL_M, BTST_P,  4, {0x6F, 0x1F, 0x17, 0x49} },              // BTST2
+    { EPD_CTRL_M, 0x08,    4, {0x6F, 0x1F, 0x1F, 0x22} },              // BTST3
+    { EPD_CTRL_M, 0x30,    1, {0x03} },                                // PLL
+    { EPD_CTRL_M, CDI,     1, {0x3F} },
+    { EPD_CTRL_M, TCON,    2, {0x02, 0x00} },
+    { EPD_CTRL_M, TRES,    4, {0x03, 0x20, 0x01, 0xE0} },
+    { EPD_CTRL_M, 0x84,    1, {0x01} },                                // T_VDCS
+    { EPD_CTRL_M, PWS,     1, {0x2F} },
+};
+
+// The 7.3" reference driver's TurnOnDisplay re-sends BTST2 between PON and DRF
+static const EPD_InitCmd EPD_7IN3E_PreDrf[EPD_7IN3E_Panel::PRE_DRF_COUNT] = {
+    { EPD_CTRL_M, BTST_P,  4, {0x6F, 0x1F, 0x17, 0x49} },              // BTST2
+};
+const EPD_InitCmd* const EPD_7IN3E_Panel::PRE_DRF = EPD_7IN3E_PreDrf;
@@ -0,0 +1,118 @@
+#pragma once
+#include "DEV_Config.h"
+
+/**
+ * Compile-time panel descriptors
+ *
+ * Each supported Waveshare Spectra/ACeP panel is described by a struct of
+ * constexpr geometry, pixel format, palette codes and its init command set.
+ * EPD_Driver<Panel> (EPD_Driver.h) is instantiated on one of these, so line
+ * sizes, loop bounds and nibble packing are all resolved by the compiler.
+ *
+ * The panel built into the firmware is chosen with EPD_PANEL, e.g.
+ *   -DEPD_PANEL=EPD_7IN3E_Panel
+ * and defaults to the 13.3" dual-controller panel.
+ */
+
+// Controller registers (shared by the Spectra 6 controller family)
+#define PSR             0x00
+#define PWR_epd         0x01
+#define POF             0x02
+#define PON             0x04
+#define BTST_N          0x05
+#define BTST_P          0x06
+#define DTM             0x10
+#define DRF             0x12
+#define CDI             0x50
+#define TCON            0x60
+#define TRES            0x61
+#define AN_TM           0x74
+#define AGID            0x86
+#define BUCK_BOOST_VDDN 0xB0
+#define TFT_VCOM_POWER  0xB1
+#define EN_BUF          0xB6
+#define BOOST_VDDP_EN   0xB7
+#define CCSET           0xE0
+#define PWS             0xE3
+#define CMD66           0xF0
+
+// Controllers addressed by an init command (bit 0 = Master, bit 1 = Slave)
+#define EPD_CTRL_M      0x01
+#define EPD_CTRL_S      0x02
+#define EPD_CTRL_ALL    (EPD_CTRL_M | EPD_CTRL_S)
+
+#define EPD_INIT_MAX_DATA 9
+
+struct EPD_InitCmd {
+    UBYTE ctrl;                      // EPD_CTRL_* mask
+    UBYTE cmd;
+    UBYTE len;
+    UBYTE data[EPD_INIT_MAX_DATA];
+};
+
+/**
+ * Waveshare 13.3inch e-Paper (E) - 1200x1600, Spectra 6
+ * Two controllers, each driving a 600x1600 half (Master left, Slave right).
+ * Commands are framed by CS only; the DC line is not used.
+ */
+struct EPD_13IN3E_Panel {
+    static constexpr const char* NAME = "13.3 INCH COLOR DISPLAY";
+
+    static constexpr UWORD WIDTH  = 1200;
+    static constexpr UWORD HEIGHT = 1600;
+    static constexpr UBYTE CONTROLLERS    = 2;
+    static constexpr UBYTE BITS_PER_PIXEL = 4;
+
+    static constexpr UBYTE BLACK  = 0x0;
+    static constexpr UBYTE WHITE  = 0x1;
+    static constexpr UBYTE YELLOW = 0x2;
+    static constexpr UBYTE RED    = 0x3;
+    static constexpr UBYTE BLUE   = 0x5;
+    static constexpr UBYTE GREEN  = 0x6;
+
+    static constexpr bool  USES_DC          = false;
+    static constexpr UBYTE RESET_PULSES     = 2;      // Official double reset
+    static constexpr bool  BUSY_AFTER_RESET = false;
+    static constexpr bool  POF_WAIT_BUSY    = false;  // Timing sensitive, see EPD_Driver::Refresh()
+
+    static constexpr UBYTE INIT_COUNT = 16;
+    static const EPD_InitCmd INIT[INIT_COUNT];
+
+    static constexpr UBYTE PRE_DRF_COUNT = 0;  // Sent between PON and DRF
+    static const EPD_InitCmd* const PRE_DRF;
+};
+
+/**
+ * Waveshare 7.3inch e-Paper (E) - 800x480, Spectra 6
+ * Single controller; commands are flagged by pulling DC low.
+ */
+struct EPD_7IN3E_Panel {
+    static constexpr const char* NAME = "7.3 INCH COLOR DISPLAY";
+
+    static constexpr UWORD WIDTH  = 800;
+    static constexpr UWORD HEIGHT = 480;
+    static constexpr UBYTE CONTROLLERS    = 1;
+    static constexpr UBYTE BITS_PER_PIXEL = 4;
+
+    static constexpr UBYTE BLACK  = 0x0;
+    static constexpr UBYTE WHITE  = 0x1;
+    static constexpr UBYTE YELLOW = 0x2;
+    static constexpr UBYTE RED    = 0x3;
+    static constexpr UBYTE BLUE   = 0x5;
+    static constexpr UBYTE GREEN  = 0x6;
+
+    static constexpr bool  USES_DC          = true;
+    static constexpr UBYTE RESET_PULSES     = 1;
+    static constexpr bool  BUSY_AFTER_RESET = true;   // Reference: Reset, ReadBusyH, 30 ms
+    static constexpr bool  POF_WAIT_BUSY    = true;
+
+    static constexpr UBYTE INIT_COUNT = 13;
+    static const EPD_InitCmd INIT[INIT_COUNT];
+
+    static constexpr UBYTE PRE_DRF_COUNT = 1;  // BTST2 again after PON
+    static const EPD_InitCmd* const PRE_DRF;
+};
+
+#ifndef EPD_PANEL
+#define EPD_PANEL EPD_13IN3E_Panel
+#endif
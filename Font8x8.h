@@ -0,0 +1,5 @@
+#pragma once
+#include <Arduino.h>
+
+// 8x8 bitmap font, ASCII printable characters (32-126), MSB = leftmost pixel
+extern const uint8_t font8x8_basic[95][8];
@@ -0,0 +1,343 @@
+#include "FrameCache.h"
+#include "Log.h"
+#include <LittleFS.h>
+#include "mbedtls/sha256.h"
+#include "mbedtls/version.h"
+
+#if MBEDTLS_VERSION_NUMBER < 0x03000000
+#define mbedtls_sha256_starts  mbedtls_sha256_starts_ret
+#define mbedtls_sha256_update  mbedtls_sha256_update_ret
+#define mbedtls_sha256_finish  mbedtls_sha256_finish_ret
+#endif
+
+#define FC_DIR        "/fc"
+#define FC_INDEX      FC_DIR "/index"
+#define FC_TMP        FC_DIR "/tmp"
+#define FC_INDEX_MAGIC 0x31434645  // "EFC1"
+#define FC_PENDING    4            // Verified frames remembered without room
+
+struct FrameCacheEntry {
+    uint8_t  hash[FRAME_HASH_LEN];
+    uint32_t last_used;            // LRU stamp, 0 = free slot
+};
+
+static bool            fc_mounted = false;
+static uint32_t        fc_frame_bytes = 0;
+static uint32_t        fc_clock = 0;
+static FrameCacheEntry fc_index[FRAME_CACHE_MAX_ENTRIES];
+
+static uint8_t fc_on_glass[FRAME_HASH_LEN];
+static bool    fc_on_glass_valid = false;
+
+// Insert in progress
+static bool    fc_inserting = false;
+static uint8_t fc_insert_hash[FRAME_HASH_LEN];
+static uint32_t fc_insert_bytes = 0;
+static int     fc_insert_slot = -1;   // Free index slot, taken on commit
+static File    fc_insert_file;
+static mbedtls_sha256_context fc_sha;
+
+// Frames that verified but did not fit, waiting for a second sighting (RAM only)
+struct FrameCachePending {
+    uint8_t  hash[FRAME_HASH_LEN];
+    uint32_t seen;                 // fc_clock when last sent, 0 = free
+};
+static FrameCachePending fc_pending[FC_PENDING];
+
+// Statistics since boot
+static uint32_t fc_offers = 0, fc_hits = 0, fc_identical = 0;
+static uint64_t fc_bytes_saved = 0;
+
+static String FrameCache_Path(const uint8_t *hash) {
+    char name[sizeof(FC_DIR) + 1 + FRAME_HASH_LEN * 2];
+    char *p = name + sprintf(name, FC_DIR "/");
+    for (int i = 0; i < FRAME_HASH_LEN; i++) p += sprintf(p, "%02x", hash[i]);
+    return String(name);
+}
+
+int32_t FrameCache_Tag(const uint8_t *hash) {
+    return (int32_t)(hash[0] << 24 | hash[1] << 16 | hash[2] << 8 | hash[3]);
+}
+
+static int FrameCache_Find(const uint8_t *hash) {
+    for (int i = 0; i < FRAME_CACHE_MAX_ENTRIES; i++) {
+        if (fc_index[i].last_used && memcmp(fc_index[i].hash, hash, FRAME_HASH_LEN) == 0) return i;
+    }
+    return -1;
+}
+
+static void FrameCache_SaveIndex(void) {
+    File f = LittleFS.open(FC_INDEX, "w");
+    if (!f) return;
+    const uint32_t magic = FC_INDEX_MAGIC;
+    f.write((const uint8_t *)&magic, sizeof magic);
+    f.write((const uint8_t *)&fc_frame_bytes, sizeof fc_frame_bytes);
+    f.write((const uint8_t *)fc_index, sizeof fc_index);
+    f.close();
+}
+
+static void FrameCache_LoadIndex(void) {
+    memset(fc_index, 0, sizeof fc_index);
+    File f = LittleFS.open(FC_INDEX, "r");
+    if (!f) return;
+    uint32_t magic = 0, frame_bytes = 0;
+    bool ok = f.read((uint8_t *)&magic, sizeof magic) == sizeof magic &&
+              f.read((uint8_t *)&frame_bytes, sizeof frame_bytes) == sizeof frame_bytes &&
+              magic == FC_INDEX_MAGIC && frame_bytes == fc_frame_bytes &&
+              f.read((uint8_t *)fc_index, sizeof fc_index) == sizeof fc_index;
+    f.close();
+    if (!ok) {
+        // Different panel or format, or torn write: the frames are orphaned
+        // and removed by FrameCache_Prune()
+        memset(fc_index, 0, sizeof fc_index);
+        return;
+    }
+
+    // Drop entries whose frame file is missing or truncated
+    bool dropped = false;
+    for (int i = 0; i < FRAME_CACHE_MAX_ENTRIES; i++) {
+        if (!fc_index[i].last_used) continue;
+        File e = LittleFS.open(FrameCache_Path(fc_index[i].hash), "r");
+        const bool valid = e && e.size() == fc_frame_bytes;
+        if (e) e.close();
+        if (!valid) {
+            LittleFS.remove(FrameCache_Path(fc_index[i].hash));
+            fc_index[i].last_used = 0;
+            dropped = true;
+        }
+        if (fc_index[i].last_used > fc_clock) fc_clock = fc_index[i].last_used;
+    }
+    if (dropped) FrameCache_SaveIndex();
+}
+
+// Is name (with or without the directory) a file the cache still owns?
+static bool FrameCache_Owned(const char *name) {
+    const char *base = strrchr(name, '/');
+    base = base ? base + 1 : name;
+    if (strcmp(base, "index") == 0) return true;
+    for (int i = 0; i < FRAME_CACHE_MAX_ENTRIES; i++) {
+        // Path is FC_DIR "/" + hex; sizeof(FC_DIR) skips the directory and the slash
+        if (fc_index[i].last_used && strcmp(FrameCache_Path(fc_index[i].hash).c_str() + sizeof(FC_DIR), base) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Delete files no index entry refers to (index lost or rewritten mid-update);
+// they would otherwise hold flash that eviction can never reclaim
+static void FrameCache_Prune(void) {
+    for (;;) {
+        String orphan;
+        File dir = LittleFS.open(FC_DIR);
+        if (!dir) return;
+        for (File f = dir.openNextFile(); f && !orphan.length(); f = dir.openNextFile()) {
+            if (!f.isDirectory() && !FrameCache_Owned(f.name())) {
+                const char *base = strrchr(f.name(), '/');
+                orphan = String(FC_DIR "/") + (base ? base + 1 : f.name());
+            }
+            f.close();
+        }
+        dir.close();
+        if (!orphan.length()) return;
+        LittleFS.remove(orphan);  // Not while the directory is open
+    }
+}
+
+// Free index slot if a frame fits next to the current entries, else -1
+static int FrameCache_FreeSlot(void) {
+    int free_slot = -1;
+    for (int i = 0; i < FRAME_CACHE_MAX_ENTRIES && free_slot < 0; i++) {
+        if (!fc_index[i].last_used) free_slot = i;
+    }
+    size_t avail = LittleFS.totalBytes() - LittleFS.usedBytes();
+    return avail > fc_frame_bytes + 4096 ? free_slot : -1;  // Block slack
+}
+
+// Evict least recently used entries not used since 'seen' until a frame fits
+// and a slot is free. Returns the slot, or -1 if that would take a newer frame.
+static int FrameCache_MakeRoom(uint32_t seen) {
+    int slot;
+    while ((slot = FrameCache_FreeSlot()) < 0) {
+        int lru = -1;
+        for (int i = 0; i < FRAME_CACHE_MAX_ENTRIES; i++) {
+            if (!fc_index[i].last_used) continue;
+            if (lru < 0 || fc_index[i].last_used < fc_index[lru].last_used) lru = i;
+        }
+        if (lru < 0 || fc_index[lru].last_used > seen) return -1;
+
+        LOG_I(EV_CACHE_EVICT, FrameCache_Tag(fc_index[lru].hash));
+        LittleFS.remove(FrameCache_Path(fc_index[lru].hash));
+        fc_index[lru].last_used = 0;
+        FrameCache_SaveIndex();
+    }
+    return slot;
+}
+
+static FrameCachePending *FrameCache_FindPending(const uint8_t *hash) {
+    for (int i = 0; i < FC_PENDING; i++) {
+        if (fc_pending[i].seen && memcmp(fc_pending[i].hash, hash, FRAME_HASH_LEN) == 0) return &fc_pending[i];
+    }
+    return NULL;
+}
+
+// Remember a frame that did not fit; the oldest sighting makes way
+static void FrameCache_AddPending(const uint8_t *hash) {
+    FrameCachePending *p = FrameCache_FindPending(hash);
+    for (int i = 0; !p && i < FC_PENDING; i++) {
+        if (!fc_pending[i].seen) p = &fc_pending[i];
+    }
+    for (int i = 0; !p && i < FC_PENDING; i++) {
+        if (i == 0 || fc_pending[i].seen < p->seen) p = &fc_pending[i];
+    }
+    memcpy(p->hash, hash, FRAME_HASH_LEN);
+    p->seen = ++fc_clock;
+}
+
+// Forget an entry whose file turned out unreadable
+static void FrameCache_Drop(int i) {
+    LittleFS.remove(FrameCache_Path(fc_index[i].hash));
+    fc_index[i].last_used = 0;
+    FrameCache_SaveIndex();
+}
+
+bool FrameCache_Begin(uint32_t frame_bytes) {
+    fc_frame_bytes = frame_bytes;
+    fc_mounted = LittleFS.begin(true);
+    if (!fc_mounted) {
+        Serial.println("Frame cache: no filesystem - caching disabled");
+        return false;
+    }
+    if (!LittleFS.exists(FC_DIR)) LittleFS.mkdir(FC_DIR);
+    LittleFS.remove(FC_TMP);  // Leftover from an interrupted insert
+    FrameCache_LoadIndex();
+    FrameCache_Prune();
+
+    int n = 0;
+    for (int i = 0; i < FRAME_CACHE_MAX_ENTRIES; i++) if (fc_index[i].last_used) n++;
+    Serial.printf("Frame cache: %d frame(s), %u/%u KB used\n", n,
+                  (unsigned)(LittleFS.usedBytes() / 1024), (unsigned)(LittleFS.totalBytes() / 1024));
+    return true;
+}
+
+FrameCacheVerdict FrameCache_Lookup(const uint8_t *hash) {
+    fc_offers++;
+    if (fc_on_glass_valid && memcmp(fc_on_glass, hash, FRAME_HASH_LEN) == 0) {
+        fc_identical++;
+        fc_bytes_saved += fc_frame_bytes;
+        return FC_IDENTICAL;
+    }
+    if (fc_mounted && FrameCache_Find(hash) >= 0) return FC_HIT;
+    return FC_MISS;
+}
+
+File FrameCache_Open(const uint8_t *hash) {
+    int i = FrameCache_Find(hash);
+    if (i < 0) return File();
+    File f = LittleFS.open(FrameCache_Path(hash), "r");
+    if (!f || f.size() != fc_frame_bytes) {
+        if (f) f.close();
+        FrameCache_Drop(i);
+        return File();
+    }
+    fc_index[i].last_used = ++fc_clock;
+    FrameCache_SaveIndex();
+    return f;
+}
+
+void FrameCache_EndHit(const uint8_t *hash, bool rendered) {
+    if (!rendered) {
+        // Short read from flash: the entry is damaged
+        int i = FrameCache_Find(hash);
+        if (i >= 0) FrameCache_Drop(i);
+        FrameCache_SetOnGlass(NULL);
+        return;
+    }
+    fc_hits++;
+    fc_bytes_saved += fc_frame_bytes;
+    FrameCache_SetOnGlass(hash);
+}
+
+void FrameCache_BeginInsert(const uint8_t *hash) {
+    memcpy(fc_insert_hash, hash, FRAME_HASH_LEN);
+    fc_insert_bytes = 0;
+    mbedtls_sha256_init(&fc_sha);
+    mbedtls_sha256_starts(&fc_sha, 0);
+    fc_inserting = true;
+
+    // A first-time frame only takes free space: a one-off, aborted or
+    // mismatched upload must not cost a cached frame. A frame sent again
+    // since it last failed to fit may evict entries not used in between.
+    fc_insert_slot = fc_mounted ? FrameCache_FreeSlot() : -1;
+    FrameCachePending *p = fc_insert_slot < 0 && fc_mounted ? FrameCache_FindPending(hash) : NULL;
+    if (p) {
+        fc_insert_slot = FrameCache_MakeRoom(p->seen);
+        p->seen = 0;
+    }
+    if (fc_insert_slot >= 0) {
+        fc_insert_file = LittleFS.open(FC_TMP, "w");
+    }
+    if (!fc_insert_file) LOG_W(EV_CACHE_NO_ROOM);
+}
+
+void FrameCache_Write(const uint8_t *data, size_t len) {
+    if (!fc_inserting) return;
+    mbedtls_sha256_update(&fc_sha, data, len);
+    fc_insert_bytes += len;
+    if (fc_insert_file && fc_insert_file.write(data, len) != len) {
+        LOG_W(EV_CACHE_WRITE_FAIL);
+        fc_insert_file.close();
+        LittleFS.remove(FC_TMP);
+    }
+}
+
+bool FrameCache_EndInsert(bool complete) {
+    if (!fc_inserting) return false;
+    fc_inserting = false;
+
+    uint8_t digest[FRAME_HASH_LEN];
+    mbedtls_sha256_finish(&fc_sha, digest);
+    mbedtls_sha256_free(&fc_sha);
+
+    bool stored = (bool)fc_insert_file;
+    if (fc_insert_file) fc_insert_file.close();
+
+    bool verified = complete && fc_insert_bytes == fc_frame_bytes &&
+                    memcmp(digest, fc_insert_hash, FRAME_HASH_LEN) == 0;
+    if (!verified) {
+        if (stored) LittleFS.remove(FC_TMP);
+        if (complete) {
+            // Refreshed, but not with the content that was offered
+            LOG_W(EV_CACHE_MISMATCH);
+            FrameCache_SetOnGlass(NULL);
+        }
+        return false;
+    }
+    FrameCache_SetOnGlass(digest);
+    if (!stored) {
+        // Verified but no room: it may claim a slot if it comes back
+        if (fc_mounted) FrameCache_AddPending(digest);
+        return true;
+    }
+
+    if (!LittleFS.rename(FC_TMP, FrameCache_Path(digest))) {
+        LittleFS.remove(FC_TMP);
+        return true;
+    }
+    memcpy(fc_index[fc_insert_slot].hash, digest, FRAME_HASH_LEN);
+    fc_index[fc_insert_slot].last_used = ++fc_clock;
+    FrameCache_SaveIndex();
+    LOG_I(EV_CACHE_STORED, FrameCache_Tag(digest));
+    return true;
+}
+
+void FrameCache_SetOnGlass(const uint8_t *hash) {
+    fc_on_glass_valid = (hash != NULL);
+    if (hash) memcpy(fc_on_glass, hash, FRAME_HASH_LEN);
+}
+
+void FrameCache_PrintStats(void) {
+    const uint32_t offers = fc_offers ? fc_offers : 1;
+    LOG_I(EV_CACHE_STATS, fc_hits * 100 / offers, fc_identical * 100 / offers, fc_offers,
+          fc_bytes_saved / 1024);
+}
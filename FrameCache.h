@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+/**
+ * Content-addressed frame cache
+ *
+ * Frames are stored in flash (LittleFS, /fc/<sha256 hex>) as the exact
+ * controller line stream written to the panel, so a cache hit replays
+ * through the same Begin/WriteLine/End path as a network frame.
+ * A new frame is stored only in free space. One that verified but did not
+ * fit is remembered in RAM; if it is sent again, it evicts least recently
+ * used entries that have not been used since its last sighting. Frames
+ * shown in alternation therefore keep whichever one is already cached
+ * instead of rewriting flash every cycle.
+ *
+ * The key is the SHA-256 of the native frame body (all controller blocks,
+ * LINE_BYTES per line, as written to the panel). It is verified while the
+ * frame streams in; a frame whose hash does not match its offer is never
+ * inserted.
+ */
+
+#define FRAME_HASH_LEN          32
+#define FRAME_CACHE_MAX_ENTRIES 16
+
+enum FrameCacheVerdict {
+    FC_MISS,       // Unknown: sender must transfer the frame
+    FC_HIT,        // In flash: render locally
+    FC_IDENTICAL   // Already on the glass: nothing to do
+};
+
+// Mount the cache filesystem and load the index. Without it every lookup misses.
+bool FrameCache_Begin(uint32_t frame_bytes);
+
+// Classify an offered hash; identical frames are counted here, hits in EndHit
+FrameCacheVerdict FrameCache_Lookup(const uint8_t *hash);
+
+// Open a cached frame for reading and mark it most recently used.
+// Invalid if the file is missing or truncated (the entry is then dropped).
+File FrameCache_Open(const uint8_t *hash);
+
+// Finish rendering a hit: count it if rendered, else drop the damaged entry
+void FrameCache_EndHit(const uint8_t *hash, bool rendered);
+
+// Start hashing (and, space permitting, storing) the frame about to be streamed
+void FrameCache_BeginInsert(const uint8_t *hash);
+
+// Feed one line of the frame being inserted; no-op outside an insert
+void FrameCache_Write(const uint8_t *data, size_t len);
+
+// Finish an insert: commit it if complete and the hash matches the offer
+bool FrameCache_EndInsert(bool complete);
+
+// Record what is on the glass (NULL = unknown content)
+void FrameCache_SetOnGlass(const uint8_t *hash);
+
+// First four hash bytes, enough to tell frames apart in the log
+int32_t FrameCache_Tag(const uint8_t *hash);
+
+// Log hit and identical rates and bytes saved since boot
+void FrameCache_PrintStats(void);
@@ -0,0 +1,119 @@
+#include "Log.h"
+#include <atomic>
+
+/**
+ * Ring slots are claimed with one atomic increment, so writers never block
+ * or take a lock. Each slot carries its sequence number + 1, published last;
+ * readers copy a slot and re-check that number (seqlock) to reject records
+ * overwritten mid-copy. When the ring is full the oldest events are dropped.
+ */
+
+struct LogRecord {
+    std::atomic<uint32_t> seq;     // Sequence + 1 once complete, 0 while written
+    uint32_t ts_us;
+    uint16_t id;
+    uint8_t  level;
+    int32_t  arg[LOG_MAX_ARGS];
+};
+
+struct LogEvent {
+    uint32_t ts_us;
+    uint16_t id;
+    uint8_t  level;
+    int32_t  arg[LOG_MAX_ARGS];
+};
+
+#define LOG_EVENT_FMT(id, fmt) fmt,
+static const char *const log_formats[EV_COUNT] = { LOG_EVENTS(LOG_EVENT_FMT) };
+#undef LOG_EVENT_FMT
+
+static LogRecord log_ring[LOG_RING_SIZE];
+static std::atomic<uint32_t> log_head(0);
+
+enum LogReadResult { LOG_READ_OK, LOG_READ_PENDING, LOG_READ_LOST };
+
+void Log_Event(uint8_t level, uint16_t id, int32_t a0, int32_t a1, int32_t a2, int32_t a3) {
+    const uint32_t s = log_head.fetch_add(1, std::memory_order_relaxed);
+    LogRecord &r = log_ring[s & (LOG_RING_SIZE - 1)];
+    r.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    r.ts_us  = micros();
+    r.id     = id;
+    r.level  = level;
+    r.arg[0] = a0;
+    r.arg[1] = a1;
+    r.arg[2] = a2;
+    r.arg[3] = a3;
+    r.seq.store(s + 1, std::memory_order_release);
+}
+
+static LogReadResult Log_Read(uint32_t s, LogEvent &e) {
+    if (log_head.load(std::memory_order_acquire) - s > LOG_RING_SIZE) return LOG_READ_LOST;
+
+    const LogRecord &r = log_ring[s & (LOG_RING_SIZE - 1)];
+    if (r.seq.load(std::memory_order_acquire) != s + 1) return LOG_READ_PENDING;
+    e.ts_us = r.ts_us;
+    e.id    = r.id;
+    e.level = r.level;
+    memcpy(e.arg, r.arg, sizeof e.arg);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (r.seq.load(std::memory_order_relaxed) != s + 1) return LOG_READ_LOST;
+    return LOG_READ_OK;
+}
+
+static void Log_Format(Print &out, const LogEvent &e) {
+    out.printf("[%6lu.%03lu] %c ", (unsigned long)(e.ts_us / 1000000),
+               (unsigned long)(e.ts_us / 1000 % 1000), e.level <= LOG_LEVEL_DEBUG ? "-EWID"[e.level] : '?');
+    if (e.id < EV_COUNT) {
+        out.printf(log_formats[e.id], e.arg[0], e.arg[1], e.arg[2], e.arg[3]);
+    } else {
+        out.printf("event %u (%d, %d, %d, %d)", e.id,
+                   (int)e.arg[0], (int)e.arg[1], (int)e.arg[2], (int)e.arg[3]);
+    }
+    out.print("\r\n");
+}
+
+void Log_Dump(Print &out) {
+    const uint32_t head = log_head.load(std::memory_order_acquire);
+    uint32_t s = head > LOG_RING_SIZE ? head - LOG_RING_SIZE : 0;
+    out.printf("Event log: #%u..#%u\r\n", (unsigned)s, (unsigned)head);
+    for (; s != head; s++) {
+        LogEvent e;
+        if (Log_Read(s, e) == LOG_READ_OK) Log_Format(out, e);
+    }
+}
+
+#if LOG_SERIAL
+// Low-priority drain: formats new events to Serial in batches
+static void Log_Task(void *) {
+    uint32_t tail = 0;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        const uint32_t head = log_head.load(std::memory_order_acquire);
+        uint32_t lost = 0;
+        if (head - tail > LOG_RING_SIZE) {
+            lost = head - tail - LOG_RING_SIZE;
+            tail = head - LOG_RING_SIZE;
+        }
+        while (tail != head) {
+            LogEvent e;
+            LogReadResult rc = Log_Read(tail, e);
+            if (rc == LOG_READ_PENDING) break;  // Writer still filling it in
+            if (rc == LOG_READ_OK) Log_Format(Serial, e);
+            else lost++;
+            tail++;
+        }
+        if (lost) {
+            LogEvent e = { (uint32_t)micros(), EV_LOG_LOST, LOG_LEVEL_WARN, { (int32_t)lost, 0, 0, 0 } };
+            Log_Format(Serial, e);
+        }
+    }
+}
+#endif
+
+void Log_Begin(void) {
+#if LOG_SERIAL
+    // Core 0 next to the WiFi stack, lowest non-idle priority
+    xTaskCreatePinnedToCore(Log_Task, "log", 3072, NULL, tskIDLE_PRIORITY + 1, NULL, 0);
+#endif
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Deferred binary event log
+ *
+ * Hot-path code records compact events (ID, level, microsecond timestamp,
+ * up to four integer arguments) into a lock-free ring buffer instead of
+ * formatting text on the UART. Formatting happens later, off the frame path:
+ * - a low-priority task drains new events to Serial (LOG_SERIAL)
+ * - Log_Dump() prints the retained history, e.g. to a TCP client ("EL")
+ *
+ * Levels are compile-time: LOG_x() calls above LOG_LEVEL become dead code,
+ * so neither the call nor its arguments are ever evaluated.
+ */
+
+#define LOG_LEVEL_NONE   0
+#define LOG_LEVEL_ERROR  1
+#define LOG_LEVEL_WARN   2
+#define LOG_LEVEL_INFO   3
+#define LOG_LEVEL_DEBUG  4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#ifndef LOG_SERIAL
+#define LOG_SERIAL 1            // Drain events to Serial from a background task
+#endif
+
+#define LOG_RING_SIZE    256    // Events retained (power of two)
+#define LOG_MAX_ARGS     4
+
+/**
+ * Event table: ID and printf format (int32 arguments only)
+ * Append new events at the end so IDs stay stable for host decoders.
+ */
+#define LOG_EVENTS(X) \
+    X(EV_EPD_BUSY,          "e-Paper busy") \
+    X(EV_EPD_BUSY_RELEASE,  "e-Paper busy release after %d ms") \
+    X(EV_EPD_PON,           "Write PON") \
+    X(EV_EPD_DRF,           "Write DRF") \
+    X(EV_EPD_POF,           "Write POF") \
+    X(EV_EPD_REFRESH_DONE,  "Display done in %d ms") \
+    X(EV_SPLASH_START,      "Boot splash: color bands + text") \
+    X(EV_SPLASH_DONE,       "Boot splash complete") \
+    X(EV_LINE,              "%c line %d/%d") \
+    X(EV_STREAM_ERROR,      "Stream %c error at line %d") \
+    X(EV_STREAM_TOTAL,      "%c total bytes=%d") \
+    X(EV_CLIENT,            "Client connected") \
+    X(EV_HEADER_TIMEOUT,    "Header timeout") \
+    X(EV_HEADER,            "Header: w=%d h=%d fmt=%d") \
+    X(EV_BAD_HEADER,        "Bad header") \
+    X(EV_FRAME_DONE,        "Frame done in %d ms") \
+    X(EV_FRAME_INCOMPLETE,  "Incomplete frame; skip refresh") \
+    X(EV_SCREEN_OFF,        "Screen powered OFF until next update") \
+    X(EV_OFFER_TIMEOUT,     "Offer timeout") \
+    X(EV_OFFER,             "Offer %08x…: %c") \
+    X(EV_CACHE_EVICT,       "Cache evict %08x…") \
+    X(EV_CACHE_NO_ROOM,     "Frame cache: no room - frame will not be cached this time") \
+    X(EV_CACHE_WRITE_FAIL,  "Frame cache: write failed - frame will not be cached") \
+    X(EV_CACHE_MISMATCH,    "Frame cache: hash mismatch - not cached") \
+    X(EV_CACHE_STORED,      "Frame cached %08x…") \
+    X(EV_CACHE_STATS,       "Cache: hit rate %d%%, identical %d%% of %d offers, saved %d KB") \
+    X(EV_LOG_LOST,          "Log overrun: %d event(s) lost") \
+    X(EV_BATTERY,           "Battery: %d mV (%d%%)") \
+    X(EV_SPLASH_CANCELLED,  "Boot splash preempted at %c line %d") \
+    X(EV_SPLASH_SKIPPED,    "Boot splash skipped (warm boot)") \
+    X(EV_BOOT_LISTEN,       "Listening on %d at %d ms") \
+    X(EV_BOOT_FIRST_ACCEPT, "First client at %d ms") \
+    X(EV_BOOT_FIRST_FRAME,  "First frame on glass at %d ms") \
+    X(EV_LINE_COST,         "%c per line: decode %d us (max %d), SPI %d us")
+
+#define LOG_EVENT_ID(id, fmt) id,
+enum LogEventId : uint16_t { LOG_EVENTS(LOG_EVENT_ID) EV_COUNT };
+#undef LOG_EVENT_ID
+
+// Start the Serial drain task (when LOG_SERIAL)
+void Log_Begin(void);
+
+// Record one event; lock-free, safe from any task
+void Log_Event(uint8_t level, uint16_t id, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0);
+
+// Format every retained event to out, oldest first
+void Log_Dump(Print &out);
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(...) Log_Event(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_E(...) do { if (0) Log_Event(LOG_LEVEL_ERROR, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(...) Log_Event(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_W(...) do { if (0) Log_Event(LOG_LEVEL_WARN, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(...) Log_Event(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_I(...) do { if (0) Log_Event(LOG_LEVEL_INFO, __VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(...) Log_Event(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_D(...) do { if (0) Log_Event(LOG_LEVEL_DEBUG, __VA_ARGS__); } while (0)
+#endif
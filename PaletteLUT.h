@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Measured-palette color lookup, generated by tools/gen_palette_lut.py
+ *
+ * EPD_PaletteLUT maps an RGB555 index (r5 << 10 | g5 << 5 | b5) to the
+ * nearest Spectra 6 color code, two codes per byte (even index in the low
+ * nibble). EPD_PaletteRGB is the measured sRGB of each code, used as the
+ * reference for error diffusion. Both live in flash.
+ */
+#define EPD_LUT_BITS  5
+
+extern const uint8_t EPD_PaletteLUT[1 << (3 * EPD_LUT_BITS - 1)];
+extern const uint8_t EPD_PaletteRGB[8][3];
@@ -0,0 +1,134 @@
+#include "PixelFormat.h"
+#include "PaletteLUT.h"
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define EPD_BE32(x) __builtin_bswap32(x)
+#else
+#define EPD_BE32(x) (x)
+#endif
+
+// Move eight 3-bit fields (bits 3i..3i+2) to eight nibbles (bits 4i..4i+3)
+static inline uint32_t EPD_Spread3to4(uint32_t x) {
+    x = (x & 0x00000FFF) | ((x & 0x00FFF000) << 4);  // 2 x 12 bits
+    x = (x & 0x003F003F) | ((x & 0x0FC00FC0) << 2);  // 4 x 6 bits
+    x = (x & 0x07070707) | ((x & 0x38383838) << 1);  // 8 x 3 bits
+    return x;
+}
+
+void EPD_Unpack3bpp(const UBYTE *in, UBYTE *out, UDOUBLE pixels) {
+    const uint32_t *src = (const uint32_t *)in;
+    uint32_t *dst = (uint32_t *)out;
+
+    // 32 pixels: 3 input words -> 4 groups of 24 bits -> 4 output words
+    for (UDOUBLE n = pixels / 32; n; n--) {
+        const uint32_t w0 = EPD_BE32(src[0]);
+        const uint32_t w1 = EPD_BE32(src[1]);
+        const uint32_t w2 = EPD_BE32(src[2]);
+        dst[0] = EPD_BE32(EPD_Spread3to4(w0 >> 8));
+        dst[1] = EPD_BE32(EPD_Spread3to4(w0 << 16 | w1 >> 16));
+        dst[2] = EPD_BE32(EPD_Spread3to4(w1 << 8 | w2 >> 24));
+        dst[3] = EPD_BE32(EPD_Spread3to4(w2));
+        src += 3;
+        dst += 4;
+    }
+
+    // Remaining 8-pixel groups (e.g. 24 of 600 pixels), 3 bytes each
+    const UBYTE *p = (const UBYTE *)src;
+    for (UDOUBLE n = (pixels % 32) / 8; n; n--) {
+        *dst++ = EPD_BE32(EPD_Spread3to4((uint32_t)p[0] << 16 | p[1] << 8 | p[2]));
+        p += 3;
+    }
+}
+
+static inline UBYTE EPD_Lut(uint32_t i) {
+    return (EPD_PaletteLUT[i >> 1] >> ((i & 1) << 2)) & 0x0F;
+}
+
+// 8-bit channels to LUT index
+static inline uint32_t EPD_Index8(int r, int g, int b) {
+    return (uint32_t)(r >> 3) << 10 | (g >> 3) << 5 | b >> 3;
+}
+
+static inline int EPD_Clamp8(int v) {
+    return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+// One wire pixel to 8-bit channels; RGB565 expands by bit replication
+static inline void EPD_ReadRGB(const UBYTE *p, UBYTE bytes, int *c) {
+    if (bytes == 2) {
+        const uint32_t v = p[0] | p[1] << 8;
+        const int r = v >> 11, g = v >> 5 & 0x3F, b = v & 0x1F;
+        c[0] = r << 3 | r >> 2;
+        c[1] = g << 2 | g >> 4;
+        c[2] = b << 3 | b >> 2;
+    } else {
+        c[0] = p[0];
+        c[1] = p[1];
+        c[2] = p[2];
+    }
+}
+
+void EPD_QuantizeRGB565(const UBYTE *in, UBYTE *out, UDOUBLE pixels) {
+    for (UDOUBLE n = pixels / 2; n; n--) {
+        // r5 g6 b5 -> r5 g5 b5 in one shift: the g LSB falls into the masked bit
+        const uint32_t a = in[0] | in[1] << 8;
+        const uint32_t b = in[2] | in[3] << 8;
+        *out++ = EPD_Lut((a >> 1 & 0x7FE0) | (a & 0x1F)) << 4 | EPD_Lut((b >> 1 & 0x7FE0) | (b & 0x1F));
+        in += 4;
+    }
+}
+
+void EPD_QuantizeRGB888(const UBYTE *in, UBYTE *out, UDOUBLE pixels) {
+    for (UDOUBLE n = pixels / 2; n; n--) {
+        *out++ = EPD_Lut(EPD_Index8(in[0], in[1], in[2])) << 4 | EPD_Lut(EPD_Index8(in[3], in[4], in[5]));
+        in += 6;
+    }
+}
+
+static const int8_t EPD_Bayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
+void EPD_DitherOrdered(const UBYTE *in, UBYTE bytes, UBYTE *out, UDOUBLE pixels, UWORD row) {
+    const int8_t *t = EPD_Bayer4[row & 3];
+    UBYTE pair = 0;
+    for (UDOUBLE x = 0; x < pixels; x++) {
+        int c[3];
+        EPD_ReadRGB(in, bytes, c);
+        in += bytes;
+        // Same offset on all channels: shifts brightness, keeps hue
+        const int o = (t[x & 3] * 2 - 15) * EPD_DITHER_SPREAD;
+        pair = pair << 4 | EPD_Lut(EPD_Index8(EPD_Clamp8(c[0] + o), EPD_Clamp8(c[1] + o), EPD_Clamp8(c[2] + o)));
+        if (x & 1) *out++ = pair;
+    }
+}
+
+void EPD_DitherDiffuse(const UBYTE *in, UBYTE bytes, UBYTE *out, UDOUBLE pixels,
+                       int16_t *err_cur, int16_t *err_next) {
+    // Errors are kept in 1/16 units at index (x + 1) * 3, so x - 1 and x + 1 never need a bounds check
+    memset(err_next, 0, (pixels + 2) * 3 * sizeof *err_next);
+    UBYTE pair = 0;
+    for (UDOUBLE x = 0; x < pixels; x++) {
+        int c[3];
+        EPD_ReadRGB(in, bytes, c);
+        in += bytes;
+        int16_t *e = err_cur + (x + 1) * 3;
+        int16_t *d = err_next + (x + 1) * 3;
+        for (int i = 0; i < 3; i++) c[i] = EPD_Clamp8(c[i] + (e[i] >> 4));
+
+        const UBYTE code = EPD_Lut(EPD_Index8(c[0], c[1], c[2]));
+        const uint8_t *p = EPD_PaletteRGB[code];
+        for (int i = 0; i < 3; i++) {
+            const int q = c[i] - p[i];
+            e[i + 3] += q * 7;  // Right
+            d[i - 3] += q * 3;  // Below left
+            d[i]     += q * 5;  // Below
+            d[i + 3] += q;      // Below right
+        }
+        pair = pair << 4 | code;
+        if (x & 1) *out++ = pair;
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "EPD_Driver.h"
+
+/**
+ * Wire pixel formats (header byte "fmt")
+ *
+ * A format turns one received controller line into the panel's native
+ * LINE_BYTES. streamFrame() is instantiated per format, so the choice is
+ * made once per frame, never per line. Begin() resets per-controller state.
+ */
+
+#define EPD_FMT_PACKED4   0   // 4 bpp: native controller nibbles, left pixel high
+#define EPD_FMT_PACKED3   1   // 3 bpp: color codes as an MSB-first bitstream
+#define EPD_FMT_RGB565    2   // 16 bpp little-endian RGB565, quantized on device
+#define EPD_FMT_RGB888    3   // 24 bpp R, G, B bytes, quantized on device
+
+// Dithering for the RGB formats, or'ed into the format byte
+#define EPD_FMT_DITHER_MASK     0x30
+#define EPD_DITHER_NONE         0x00  // Nearest palette color
+#define EPD_DITHER_ORDERED      0x10  // 4x4 Bayer
+#define EPD_DITHER_DIFFUSE      0x20  // Floyd-Steinberg (two rows, per controller)
+
+#define EPD_DITHER_SPREAD       4     // Bayer offset step: +-60 per channel
+
+static inline bool EPD_FormatValid(UBYTE fmt) {
+    const UBYTE base = fmt & ~EPD_FMT_DITHER_MASK, dither = fmt & EPD_FMT_DITHER_MASK;
+    if (base == EPD_FMT_PACKED4 || base == EPD_FMT_PACKED3) return dither == EPD_DITHER_NONE;
+    return (base == EPD_FMT_RGB565 || base == EPD_FMT_RGB888) && dither != EPD_FMT_DITHER_MASK;
+}
+
+/**
+ * Expand a packed 3 bpp line into 4 bpp controller nibbles
+ *
+ * Every 8 pixels occupy 3 bytes (pixel 0 in the top 3 bits of the first
+ * byte). Color codes 0-6 fit in 3 bits unchanged, so no lookup is needed:
+ * 32 pixels are read as three 32-bit words and spread into four output
+ * words. Both buffers must be 4-byte aligned; pixels must be a multiple of 8.
+ */
+void EPD_Unpack3bpp(const UBYTE *in, UBYTE *out, UDOUBLE pixels);
+
+/**
+ * Quantize an RGB line to 4 bpp color codes through the palette LUT
+ *
+ * in holds pixels of 'bytes' (2: RGB565, 3: RGB888) each; pixels must be
+ * even. The plain kernels are one table lookup per pixel. The ordered
+ * dither adds a Bayer offset chosen by row; the diffusing one carries error
+ * in err_cur (into this row) and err_next (into the next row, cleared here),
+ * each (pixels + 2) * 3 entries. The caller swaps them between rows.
+ */
+void EPD_QuantizeRGB565(const UBYTE *in, UBYTE *out, UDOUBLE pixels);
+void EPD_QuantizeRGB888(const UBYTE *in, UBYTE *out, UDOUBLE pixels);
+void EPD_DitherOrdered(const UBYTE *in, UBYTE bytes, UBYTE *out, UDOUBLE pixels, UWORD row);
+void EPD_DitherDiffuse(const UBYTE *in, UBYTE bytes, UBYTE *out, UDOUBLE pixels,
+                       int16_t *err_cur, int16_t *err_next);
+
+// Native: the received line is sent as is
+template <class Driver>
+struct EPD_FormatPacked4 {
+    static constexpr UWORD WIRE_BYTES = Driver::LINE_BYTES;
+
+    static inline void Begin(void) {}
+
+    static inline const UBYTE *Decode(const UBYTE *in, UBYTE *) {
+        return in;
+    }
+};
+
+// 3 bpp palette codes: 25% less airtime than native
+template <class Driver>
+struct EPD_FormatPacked3 {
+    static_assert(Driver::BITS_PER_PIXEL == 4, "3 bpp unpacker targets nibble controllers");
+    static_assert(Driver::CTRL_WIDTH % 8 == 0, "3 bpp lines must be whole 8-pixel groups");
+
+    static constexpr UWORD WIRE_BYTES = Driver::CTRL_WIDTH * 3 / 8;
+
+    static inline void Begin(void) {}
+
+    static inline const UBYTE *Decode(const UBYTE *in, UBYTE *out) {
+        EPD_Unpack3bpp(in, out, Driver::CTRL_WIDTH);
+        return out;
+    }
+};
+
+// Error rows for diffusion: one pair per panel, shared by RGB565 and RGB888
+template <class Driver>
+struct EPD_DiffuseRows {
+    static int16_t err[2][(Driver::CTRL_WIDTH + 2) * 3];
+};
+
+template <class Driver>
+int16_t EPD_DiffuseRows<Driver>::err[2][(Driver::CTRL_WIDTH + 2) * 3];
+
+// Raw RGB, mapped to the measured palette on device; Begin() once per controller
+template <class Driver, UBYTE BYTES, UBYTE DITHER>
+struct EPD_FormatRGB {
+    static_assert(Driver::BITS_PER_PIXEL == 4, "RGB quantizer targets nibble controllers");
+    static_assert(Driver::CTRL_WIDTH % 2 == 0, "RGB lines must be whole output bytes");
+
+    static constexpr UWORD WIRE_BYTES = Driver::CTRL_WIDTH * BYTES;
+
+    static inline void Begin(void) {
+        row = 0;
+        if (DITHER == EPD_DITHER_DIFFUSE) memset(EPD_DiffuseRows<Driver>::err, 0, sizeof EPD_DiffuseRows<Driver>::err);
+    }
+
+    static inline const UBYTE *Decode(const UBYTE *in, UBYTE *out) {
+        if (DITHER == EPD_DITHER_DIFFUSE) {
+            int16_t (*err)[(Driver::CTRL_WIDTH + 2) * 3] = EPD_DiffuseRows<Driver>::err;
+            EPD_DitherDiffuse(in, BYTES, out, Driver::CTRL_WIDTH, err[row & 1], err[~row & 1]);
+        } else if (DITHER == EPD_DITHER_ORDERED) {
+            EPD_DitherOrdered(in, BYTES, out, Driver::CTRL_WIDTH, row);
+        } else if (BYTES == 2) {
+            EPD_QuantizeRGB565(in, out, Driver::CTRL_WIDTH);
+        } else {
+            EPD_QuantizeRGB888(in, out, Driver::CTRL_WIDTH);
+        }
+        row++;
+        return out;
+    }
+
+private:
+    static UWORD row;
+};
+
+template <class Driver, UBYTE BYTES, UBYTE DITHER>
+UWORD EPD_FormatRGB<Driver, BYTES, DITHER>::row;
+
+template <class Driver, UBYTE DITHER = EPD_DITHER_NONE>
+using EPD_FormatRGB565 = EPD_FormatRGB<Driver, 2, DITHER>;
+template <class Driver, UBYTE DITHER = EPD_DITHER_NONE>
+using EPD_FormatRGB888 = EPD_FormatRGB<Driver, 3, DITHER>;
@@ -1,14 +1,40 @@
 #include <WiFi.h>
 #include "esp_wifi.h"  // For Power Save mode
+#include "esp_system.h"  // esp_reset_reason()
 #include "DEV_Config.h"
-#include "EPD_13in3e.h"
+#include "Battery.h"
+#include "EPD_Driver.h"
+#include "FrameCache.h"
+#include "PixelFormat.h"
+#include "Log.h"
 #include "WiFiConfig.h"
 
-#define EPD_W 1200
-#define EPD_H 1600
-static const int BYTES_PER_LINE_HALF = EPD_W/4; // 300
+// Panel selected at build time (EPD_Panel.h), default 13.3" 1200x1600
+typedef EPD_Driver<EPD_PANEL> EPD;
 
-static bool readN(WiFiClient& c, uint8_t* buf, size_t n) {
+/**
+ * Boot state
+ * The panel (SPI bus + power pin) is shared by the boot splash task and the
+ * frame path; whoever holds panel_mutex owns it. A frame arriving during
+ * boot sets splash_cancel so the splash gives way between lines.
+ */
+static SemaphoreHandle_t panel_mutex;
+static volatile bool splash_cancel = false;
+static bool first_frame_logged = false;
+
+// RTC memory survives soft resets but not power loss: the glass still shows
+// our last image after a crash/OTA/watchdog reset, so no splash is needed
+#define GLASS_MAGIC 0x45364F4B  // "E6OK"
+RTC_NOINIT_ATTR static uint32_t glass_magic;
+
+struct PanelLock {
+  PanelLock()  { xSemaphoreTake(panel_mutex, portMAX_DELAY); }
+  ~PanelLock() { xSemaphoreGive(panel_mutex); }
+};
+
+// Works for any source with available()/read(buf, n): WiFiClient, fs::File
+template <class Source>
+static bool readN(Source& c, uint8_t* buf, size_t n) {
   size_t got=0; unsigned long t0=millis();
   while (got<n) {
     int av=c.available();
@@ -18,49 +44,145 @@ static bool readN(WiFiClient& c, uint8_t* buf, size_t n) {
   return true;
 }
 
+// Line buffers shared by every streamFrame() instantiation (a static inside
+// the template would be one copy per format and source); word-aligned for
+// the SWAR unpackers
+static uint32_t frame_wire[(EPD::CTRL_WIDTH * 3 + 3) / 4];  // Widest: RGB888
+static uint32_t frame_line[(EPD::LINE_BYTES + 3) / 4];
+
 /**
- * Calculate battery percentage for HUZZAH32 Feather
- * 
- * The HUZZAH32 includes a voltage divider on pin A13 (GPIO35) that reads
- * half the battery voltage. This allows monitoring LiPo battery levels
- * without additional hardware.
- * 
- * @return Battery percentage (0-100), or -1 if no battery detected
+ * Stream one frame body from a client or cached file into the panel
+ *
+ * Body layout: for each controller (Master first), HEIGHT lines of
+ * Format::WIRE_BYTES, decoded to the panel's LINE_BYTES. All bounds are
+ * compile-time constants of Driver and Format.
+ * Every decoded line is also fed to the frame cache while an insert is open.
+ *
+ * @return true if every line of every controller was received
  */
-int getBatteryPercentage() {
-  // Configure ADC for optimal battery reading
-  analogSetAttenuation(ADC_11db);  // 3.3V range with minimal noise
-  analogSetWidth(12);              // 12-bit resolution (0-4095)
-  
-  // Take multiple readings for stability and average them
-  int raw_total = 0;
-  const int num_readings = 5;
-  for (int i = 0; i < num_readings; i++) {
-    raw_total += analogRead(A13);   // A13 = GPIO35 with built-in voltage divider
-    delay(10);                      // Brief delay between readings
+template <class Driver, class Format, class Source>
+static bool streamFrame(Source& c) {
+  uint32_t* const wire = frame_wire;
+  uint32_t* const line = frame_line;
+  static_assert(Format::WIRE_BYTES <= sizeof frame_wire, "wire buffer too small for format");
+  static_assert(Driver::LINE_BYTES <= sizeof frame_line, "line buffer too small for panel");
+
+  for (uint8_t ctrl=0; ctrl<Driver::CONTROLLERS; ++ctrl) {
+    const char name = "MS"[ctrl];
+    Driver::BeginFrame(ctrl);
+    Format::Begin();
+    size_t total=0;
+    uint32_t decode_us=0, decode_max=0, spi_us=0;
+    for (int y=0; y<Driver::HEIGHT; ++y) {
+      if (!readN(c, (uint8_t*)wire, Format::WIRE_BYTES)) { LOG_E(EV_STREAM_ERROR, name, y); break; }
+      const uint32_t t0 = micros();
+      const uint8_t* px = Format::Decode((const uint8_t*)wire, (uint8_t*)line);
+      const uint32_t t1 = micros();
+      Driver::WriteLine(px);
+      spi_us += micros() - t1;
+      decode_us += t1 - t0;
+      if (t1 - t0 > decode_max) decode_max = t1 - t0;
+      FrameCache_Write(px, Driver::LINE_BYTES);
+      total += Format::WIRE_BYTES;
+      if ((y%100)==0) LOG_D(EV_LINE, name, y, Driver::HEIGHT);
+    }
+    Driver::EndFrame();
+    LOG_I(EV_STREAM_TOTAL, name, total);
+    LOG_I(EV_LINE_COST, name, decode_us / Driver::HEIGHT, decode_max, spi_us / Driver::HEIGHT);
+    if (total != (size_t)Driver::HEIGHT*Format::WIRE_BYTES) return false;
   }
-  int raw_avg = raw_total / num_readings;
-  
-  // Convert ADC reading to actual battery voltage
-  // HUZZAH32 voltage divider: VBAT/2 → ADC, so multiply by 2
-  float voltage = (raw_avg / 4095.0) * 3.3 * 2.0;
-  
-  // Check for very low readings (no battery or USB power only)
-  if (raw_avg < 100) {
-    Serial.println("No battery detected - using USB power");
-    return -1;  // Special value for display logic
+  return true;
+}
+
+/**
+ * Power the panel up, stream a frame into it and refresh
+ *
+ * @return true if the frame was complete and refreshed
+ */
+template <class Format, class Source>
+static bool displayFrame(Source& src) {
+  splash_cancel = true;  // A real frame always wins over the boot splash
+  PanelLock lock;
+
+  // Power ON screen for update - much longer stabilization
+#ifdef EPD_PWR_PIN
+  DEV_Digital_Write(EPD_PWR_PIN, HIGH);
+  delay(100);  // Wait for power stabilization
+#endif
+
+  // Important: ensure clean state every frame
+  const unsigned long t0 = millis();
+  EPD::Init();
+
+  bool ok = streamFrame<EPD, Format>(src);
+  if (ok) {
+    EPD::Refresh();
+    LOG_I(EV_FRAME_DONE, millis() - t0);
+    // Optional power-save; we always re-init at next frame:
+    EPD::Sleep();
+    glass_magic = GLASS_MAGIC;
+    if (!first_frame_logged) { first_frame_logged = true; LOG_I(EV_BOOT_FIRST_FRAME, millis()); }
+  } else {
+    LOG_W(EV_FRAME_INCOMPLETE);
   }
-  
-  // Calculate percentage using realistic LiPo voltage range
-  // 3.0V = 0% (safe minimum), 4.2V = 100% (full charge)
-  float percentage = ((voltage - 3.0) / (4.2 - 3.0)) * 100.0;
-  
-  // Ensure percentage stays within bounds
-  if (percentage < 0) percentage = 0;
-  if (percentage > 100) percentage = 100;
-  
-  Serial.printf("Battery: %.2fV (%d%%)\n", voltage, (int)percentage);
-  return (int)percentage;
+
+  // Power OFF screen after update to save power
+#ifdef EPD_PWR_PIN
+  delay(500);  // Let refresh complete
+  DEV_Digital_Write(EPD_PWR_PIN, LOW);
+  LOG_D(EV_SCREEN_OFF);
+#endif
+  return ok;
+}
+
+// Pick the decoder once per frame from the header format byte
+static bool displayNetworkFrame(WiFiClient& c, uint8_t fmt) {
+  switch (fmt) {
+    case EPD_FMT_PACKED3: return displayFrame<EPD_FormatPacked3<EPD> >(c);
+    case EPD_FMT_RGB565:  return displayFrame<EPD_FormatRGB565<EPD> >(c);
+    case EPD_FMT_RGB565 | EPD_DITHER_ORDERED: return displayFrame<EPD_FormatRGB565<EPD, EPD_DITHER_ORDERED> >(c);
+    case EPD_FMT_RGB565 | EPD_DITHER_DIFFUSE: return displayFrame<EPD_FormatRGB565<EPD, EPD_DITHER_DIFFUSE> >(c);
+    case EPD_FMT_RGB888:  return displayFrame<EPD_FormatRGB888<EPD> >(c);
+    case EPD_FMT_RGB888 | EPD_DITHER_ORDERED: return displayFrame<EPD_FormatRGB888<EPD, EPD_DITHER_ORDERED> >(c);
+    case EPD_FMT_RGB888 | EPD_DITHER_DIFFUSE: return displayFrame<EPD_FormatRGB888<EPD, EPD_DITHER_DIFFUSE> >(c);
+    default:              return displayFrame<EPD_FormatPacked4<EPD> >(c);
+  }
+}
+
+/**
+ * Boot splash task
+ * Powers up and resets the panel while Wi-Fi is still associating, then
+ * renders the splash once the IP is known (or the wait times out).
+ * Yields the panel to any frame that arrives first.
+ */
+static void splashTask(void*) {
+  {
+    PanelLock lock;
+    if (!splash_cancel) {
+#ifdef EPD_PWR_PIN
+      DEV_Digital_Write(EPD_PWR_PIN, HIGH);
+      delay(100);  // Wait for power stabilization
+#endif
+      EPD::Init();
+
+      // The IP goes on the splash; stop waiting if a frame claims the panel
+      const unsigned long t0 = millis();
+      while (WiFi.status() != WL_CONNECTED && millis() - t0 < 10000 && !splash_cancel) delay(50);
+
+      // A frame that got here first skips the splash entirely
+      BatteryReading bat = Battery_Get();
+      const bool shown = !splash_cancel &&
+          EPD::DisplayTextScreen(WIFI_SSID, TCP_PORT, bat.present ? bat.percent : -1, bat.mv, &splash_cancel);
+      if (shown) glass_magic = GLASS_MAGIC;
+
+      // Power OFF screen after boot splash to save power
+#ifdef EPD_PWR_PIN
+      if (shown) delay(1000);  // Let POF settle before cutting power
+      DEV_Digital_Write(EPD_PWR_PIN, LOW);
+#endif
+    }
+  }
+  vTaskDelete(NULL);
 }
 
 /**
@@ -74,13 +196,20 @@ int getBatteryPercentage() {
  * - TCP server for receiving packed 6-color image data
  * - Power optimization for battery operation
  * - Dual-controller synchronization for 1200x1600 resolution
+ * - Other Spectra panel sizes selectable at build time (EPD_PANEL)
+ * - Flash frame cache: known frames are offered by hash, not re-sent
+ * - Deferred binary event log, drained in the background and dumped over TCP
+ * - RGB565/RGB888 ingest with optional ordered or error-diffusion dithering
+ * - Parallel boot: the server listens while the splash is still rendering
  * 
  * Hardware: Adafruit HUZZAH32 Feather + Waveshare 13.3" E-Paper HAT
- * Protocol: Custom packed 6-color format (4 bits per pixel)
+ * Protocol: Custom packed 6-color format (4 or 3 bits per pixel) or raw RGB
+ *           quantized on device to the measured panel palette
  */
 
 void setup() {
   Serial.begin(115200);
+  Log_Begin();
   
   // Power optimization: Reduce CPU frequency for lower consumption
   // HUZZAH32 Feather benefits from this when running on battery
@@ -88,6 +217,8 @@ void setup() {
   
   // Initialize hardware pins and SPI communication
   DEV_Module_Init();
+  Battery_Begin();  // Sampled in the background; ready long before the splash
+  FrameCache_Begin(EPD::FRAME_BYTES);
 
 #ifdef EPD_PWR_PIN
   pinMode(EPD_PWR_PIN, OUTPUT);
@@ -96,19 +227,27 @@ void setup() {
 #endif
 
   // WiFi Configuration
-  // Connect in station mode with 10-second timeout for resilience
+  // Association runs in the background while the splash task readies the panel
   WiFi.mode(WIFI_STA);
   WiFi.begin(WIFI_SSID, WIFI_PASS);
   Serial.printf("WiFi… SSID=%s\n", WIFI_SSID);
-  
-  unsigned long wifi_start = millis();
-  while (WiFi.status() != WL_CONNECTED && millis() - wifi_start < 10000) { 
-    delay(300); 
-    Serial.print("."); 
+
+  // Boot splash on cold boots only; on warm resets the glass is still valid
+  panel_mutex = xSemaphoreCreateMutex();
+  const esp_reset_reason_t reason = esp_reset_reason();
+  if (reason != ESP_RST_POWERON && reason != ESP_RST_BROWNOUT && glass_magic == GLASS_MAGIC) {
+    LOG_I(EV_SPLASH_SKIPPED);
+  } else {
+    glass_magic = 0;
+    xTaskCreatePinnedToCore(splashTask, "splash", 4096, NULL, 1, NULL, 1);
   }
-  
+
+  // 10-second timeout for resilience
+  unsigned long wifi_start = millis();
+  while (WiFi.status() != WL_CONNECTED && millis() - wifi_start < 10000) delay(50);
+
   if (WiFi.status() == WL_CONNECTED) {
-    Serial.printf("\nOK, IP=%s\n", WiFi.localIP().toString().c_str());
+    Serial.printf("OK, IP=%s\n", WiFi.localIP().toString().c_str());
     
     // Enable WiFi Power Save mode for maximum power reduction
     // Radio sleeps between beacon intervals, wakes to check for data
@@ -122,99 +261,74 @@ void setup() {
                   ps_mode == WIFI_PS_MIN_MODEM ? "MIN" : "MAX", ps_mode);
     Serial.println("Power reduction: 80mA -> ~10mA in MAX mode");
   } else {
-    Serial.println("\nWiFi connection failed - continuing in offline mode");
+    Serial.println("WiFi connection failed - continuing in offline mode");
   }
 
-  // Power ON screen for boot splash - longer stabilization
-#ifdef EPD_PWR_PIN
-  DEV_Digital_Write(EPD_PWR_PIN, HIGH);
-  delay(100);  // Wait for power stabilization
-#endif
-  
-  // Initialize display and show boot splash (no unnecessary white clear)
-  EPD_13IN3E_Init();
-  int battery_pct = getBatteryPercentage();
-  EPD_13IN3E_ShowBootSplash(WIFI_SSID, TCP_PORT, battery_pct);
-  
-  // Power OFF screen after boot splash to save power
-#ifdef EPD_PWR_PIN
-  delay(1000);  // Let user see the splash
-  DEV_Digital_Write(EPD_PWR_PIN, LOW);
-  Serial.println("Screen powered OFF - will turn ON for updates");
-#endif
-
+  // Listen right away; a frame that arrives now preempts the splash
   static WiFiServer server(TCP_PORT);
   server.begin();
-  Serial.printf("TCP server on %u (send packed 6-color frame)\n", TCP_PORT);
-
-  static uint8_t line[BYTES_PER_LINE_HALF];
+  LOG_I(EV_BOOT_LISTEN, TCP_PORT, millis());
 
+  bool first_accept = true;
   for (;;) {
     WiFiClient c = server.available();
     if (!c) { delay(20); continue; }
-    Serial.println("Client connected");
+    LOG_I(EV_CLIENT);
+    if (first_accept) { first_accept = false; LOG_I(EV_BOOT_FIRST_ACCEPT, millis()); }
 
-    // Header: "E6" + w + h + fmt(0)
     uint8_t hdr[7];
-    if (!readN(c, hdr, sizeof hdr)) { Serial.println("Header timeout"); c.stop(); continue; }
+    if (!readN(c, hdr, 2)) { LOG_W(EV_HEADER_TIMEOUT); c.stop(); continue; }
+
+    // "EL": dump the retained event log as text and close
+    if (hdr[0]=='E' && hdr[1]=='L') { Log_Dump(c); c.stop(); continue; }
+
+    // Optional have-hash offer: "EH" + SHA-256 of the frame body
+    // Reply: 'I' identical (already shown), 'C' cached (rendered from flash),
+    // 'S' send (continue with the "E6" header and body below)
+    bool offered = false;
+    uint8_t hash[FRAME_HASH_LEN];
+    if (hdr[0]=='E' && hdr[1]=='H') {
+      if (!readN(c, hash, sizeof hash)) { LOG_W(EV_OFFER_TIMEOUT); c.stop(); continue; }
+      FrameCacheVerdict v = FrameCache_Lookup(hash);
+      // Only promise 'C' for a file that is there and complete
+      File cached;
+      if (v == FC_HIT && !(cached = FrameCache_Open(hash))) v = FC_MISS;
+      const uint8_t reply = v == FC_IDENTICAL ? 'I' : v == FC_HIT ? 'C' : 'S';
+      c.write(reply);
+      LOG_I(EV_OFFER, FrameCache_Tag(hash), reply);
+      if (v == FC_IDENTICAL) {
+        FrameCache_PrintStats();
+        c.stop(); continue;
+      }
+      if (v == FC_HIT) {
+        // Cached frames are stored in the native line format
+        FrameCache_EndHit(hash, displayFrame<EPD_FormatPacked4<EPD> >(cached));
+        cached.close();
+        FrameCache_PrintStats();
+        c.stop(); continue;
+      }
+      offered = true;
+      if (!readN(c, hdr, 2)) { LOG_W(EV_HEADER_TIMEOUT); c.stop(); continue; }
+    }
+
+    // Header: "E6" + w + h + fmt (EPD_FMT_*)
+    if (!readN(c, hdr+2, sizeof hdr - 2)) { LOG_W(EV_HEADER_TIMEOUT); c.stop(); continue; }
     uint16_t w = hdr[2] | (hdr[3] << 8);
     uint16_t h = hdr[4] | (hdr[5] << 8);
     uint8_t  f = hdr[6];
-    Serial.printf("Header: w=%u h=%u fmt=%u\n", w, h, f);
-    if (!(hdr[0]=='E' && hdr[1]=='6' && w==EPD_W && h==EPD_H && f==0)) {
-      Serial.println("Bad header"); c.stop(); continue;
+    LOG_I(EV_HEADER, w, h, f);
+    if (!(hdr[0]=='E' && hdr[1]=='6' && w==EPD::WIDTH && h==EPD::HEIGHT &&
+          EPD_FormatValid(f))) {
+      LOG_W(EV_BAD_HEADER); c.stop(); continue;
     }
 
-    // Power ON screen for update - much longer stabilization
-#ifdef EPD_PWR_PIN
-    DEV_Digital_Write(EPD_PWR_PIN, HIGH);
-    delay(100);  // Wait for power stabilization
-#endif
-    
-    // Important: ensure clean state every frame
-    EPD_13IN3E_Init();
-
-    // Left (M)
-    EPD_13IN3E_BeginFrameM();
-    size_t totalM=0;
-    for (int y=0; y<EPD_H; ++y) {
-      if (!readN(c, line, BYTES_PER_LINE_HALF)) { Serial.println("Stream M error"); break; }
-      EPD_13IN3E_WriteLineM(line);
-      totalM += BYTES_PER_LINE_HALF;
-      if ((y%100)==0) Serial.printf("M line %d/%d\r", y, EPD_H);
+    if (offered) {
+      FrameCache_BeginInsert(hash);
+      FrameCache_EndInsert(displayNetworkFrame(c, f));
+      FrameCache_PrintStats();
+    } else if (displayNetworkFrame(c, f)) {
+      FrameCache_SetOnGlass(NULL);  // Content unknown without an offer
     }
-    EPD_13IN3E_EndFrameM();
-    Serial.printf("\nM total bytes=%u\n", (unsigned)totalM);
-
-    // Right (S)
-    EPD_13IN3E_BeginFrameS();
-    size_t totalS=0;
-    for (int y=0; y<EPD_H; ++y) {
-      if (!readN(c, line, BYTES_PER_LINE_HALF)) { Serial.println("Stream S error"); break; }
-      EPD_13IN3E_WriteLineS(line);
-      totalS += BYTES_PER_LINE_HALF;
-      if ((y%100)==0) Serial.printf("S line %d/%d\r", y, EPD_H);
-    }
-    EPD_13IN3E_EndFrameS();
-    Serial.printf("\nS total bytes=%u\n", (unsigned)totalS);
-
-    if (totalM == (size_t)EPD_H*BYTES_PER_LINE_HALF &&
-        totalS == (size_t)EPD_H*BYTES_PER_LINE_HALF) {
-      Serial.println("Refresh…");
-      EPD_13IN3E_RefreshNow();
-      Serial.println("Frame done");
-      // Optional power-save; we always re-init at next frame:
-      EPD_13IN3E_Sleep();
-    } else {
-      Serial.println("Incomplete frame; skip refresh");
-    }
-    
-    // Power OFF screen after update to save power
-#ifdef EPD_PWR_PIN
-    delay(500);  // Let refresh complete
-    DEV_Digital_Write(EPD_PWR_PIN, LOW);
-    Serial.println("Screen powered OFF until next update");
-#endif
     c.stop();
   }
 }
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Send a frame to the ESP32 e-ink display over TCP.
+
+For 4bpp/3bpp the input is a native frame body: for each controller
+(Master first), HEIGHT lines of packed 4-bit color codes, left pixel in the
+high nibble (960,000 bytes for the 13.3" panel).
+
+For rgb565/rgb888 the input is any image Pillow can read, at panel size.
+The device maps it to the measured palette (PaletteLUT.cpp).
+
+  e6send.py HOST frame.bin                # fmt 0, 4 bpp as is
+  e6send.py HOST frame.bin --fmt 3bpp     # fmt 1, 25% fewer bytes
+  e6send.py HOST frame.bin --offer        # "have-hash" handshake first
+  e6send.py HOST photo.png --fmt rgb565 --dither diffuse
+"""
+import argparse
+import hashlib
+import socket
+import struct
+import sys
+
+import numpy as np
+
+FMT_PACKED4 = 0
+FMT_PACKED3 = 1
+FMT_RGB565 = 2
+FMT_RGB888 = 3
+
+FORMATS = {"4bpp": FMT_PACKED4, "3bpp": FMT_PACKED3, "rgb565": FMT_RGB565, "rgb888": FMT_RGB888}
+DITHER = {"none": 0x00, "ordered": 0x10, "diffuse": 0x20}
+
+
+def pack3(body4: bytes) -> bytes:
+    """Repack 4 bpp color codes as a 3 bpp MSB-first bitstream (8 pixels -> 3 bytes)."""
+    b = np.frombuffer(body4, dtype=np.uint8)
+    px = np.empty(b.size * 2, dtype=np.uint8)
+    px[0::2] = b >> 4
+    px[1::2] = b & 0x0F
+    if px.max(initial=0) > 7:
+        raise ValueError("color code above 7 cannot be sent at 3 bpp")
+    bits = (px[:, None] >> np.array([2, 1, 0], dtype=np.uint8)) & 1
+    return np.packbits(bits.reshape(-1)).tobytes()
+
+
+def unpack3(body3: bytes) -> bytes:
+    """Inverse of pack3, for checking."""
+    bits = np.unpackbits(np.frombuffer(body3, dtype=np.uint8))
+    px = (bits.reshape(-1, 3) * np.array([4, 2, 1], dtype=np.uint8)).sum(axis=1).astype(np.uint8)
+    return (px[0::2] << 4 | px[1::2]).tobytes()
+
+
+def rgb_body(path: str, width: int, height: int, controllers: int, fmt: int) -> bytes:
+    """Image -> per-controller RGB lines (Master first), RGB565 little-endian or RGB888."""
+    from PIL import Image  # Only needed for RGB input
+
+    img = np.asarray(Image.open(path).convert("RGB"))
+    if img.shape[:2] != (height, width):
+        raise ValueError(f"image is {img.shape[1]}x{img.shape[0]}, panel is {width}x{height}")
+    if fmt == FMT_RGB565:
+        r, g, b = (img[..., i].astype(np.uint16) for i in range(3))
+        img = (r >> 3 << 11 | g >> 2 << 5 | b >> 3).astype("<u2")
+    cw = width // controllers
+    return b"".join(img[:, c * cw:(c + 1) * cw].tobytes() for c in range(controllers))
+
+
+def recv_exact(s: socket.socket, n: int) -> bytes:
+    buf = b""
+    while len(buf) < n:
+        chunk = s.recv(n - len(buf))
+        if not chunk:
+            raise ConnectionError("connection closed")
+        buf += chunk
+    return buf
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host")
+    ap.add_argument("frame", help="native 4 bpp frame body, or an image for RGB formats")
+    ap.add_argument("--port", type=int, default=3333)
+    ap.add_argument("--width", type=int, default=1200)
+    ap.add_argument("--height", type=int, default=1600)
+    ap.add_argument("--controllers", type=int, default=2, help="1 for single-controller panels (RGB only)")
+    ap.add_argument("--fmt", choices=FORMATS, default="4bpp")
+    ap.add_argument("--dither", choices=DITHER, default="none", help="on-device dithering (RGB only)")
+    ap.add_argument("--offer", action="store_true", help="offer the SHA-256 first (frame cache)")
+    args = ap.parse_args()
+
+    fmt = FORMATS[args.fmt]
+    rgb = fmt in (FMT_RGB565, FMT_RGB888)
+    if rgb and args.offer:
+        # The cache key is the hash of the native body, which only the device computes
+        print("--offer needs a native body; not available with RGB input", file=sys.stderr)
+        return 1
+    if not rgb and args.dither != "none":
+        print("--dither applies to RGB formats only", file=sys.stderr)
+        return 1
+
+    if rgb:
+        payload = rgb_body(args.frame, args.width, args.height, args.controllers, fmt)
+    else:
+        with open(args.frame, "rb") as f:
+            body = f.read()
+        if len(body) != args.width * args.height // 2:
+            print(f"expected {args.width * args.height // 2} bytes, got {len(body)}", file=sys.stderr)
+            return 1
+        payload = pack3(body) if fmt == FMT_PACKED3 else body
+
+    with socket.create_connection((args.host, args.port)) as s:
+        if args.offer:
+            # The cache key is always the hash of the native body
+            s.sendall(b"EH" + hashlib.sha256(body).digest())
+            reply = recv_exact(s, 1)
+            if reply == b"I":
+                print("identical to screen, nothing sent")
+                return 0
+            if reply == b"C":
+                print("cached on device, nothing sent")
+                return 0
+
+        s.sendall(b"E6" + struct.pack("<HHB", args.width, args.height, fmt | DITHER[args.dither]) + payload)
+        s.shutdown(socket.SHUT_WR)
+        s.recv(1)  # Device closes after the refresh
+    print(f"sent {len(payload)} bytes ({args.fmt})")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+Generate PaletteLUT.cpp: the on-device RGB -> Spectra 6 color code table.
+
+Each cell of a 32x32x32 RGB grid maps to the swatch nearest in CIELAB
+(CIE76). Swatches are the inks as they actually look, not ideal primaries:
+photograph or measure a printed test card and pass the sRGB values in.
+
+  gen_palette_lut.py > ../PaletteLUT.cpp
+  gen_palette_lut.py --swatches swatches.json > ../PaletteLUT.cpp
+
+swatches.json: {"black": [r, g, b], "white": [...], ...} (any subset)
+"""
+import argparse
+import json
+import sys
+
+import numpy as np
+
+LUT_BITS = 5
+
+# Color code -> (name, sRGB). Codes are shared by every Spectra 6 panel in
+# EPD_Panel.h; 4 and 7 are unused and never produced.
+SWATCHES = {
+    0: ("black",  (25, 30, 33)),
+    1: ("white",  (232, 232, 232)),
+    2: ("yellow", (239, 222, 68)),
+    3: ("red",    (178, 19, 24)),
+    5: ("blue",   (33, 87, 186)),
+    6: ("green",  (18, 95, 32)),
+}
+
+
+def srgb_to_lab(rgb: np.ndarray) -> np.ndarray:
+    """sRGB (0-255, shape (..., 3)) to CIELAB, D65 white."""
+    c = rgb / 255.0
+    c = np.where(c <= 0.04045, c / 12.92, ((c + 0.055) / 1.055) ** 2.4)
+    m = np.array([[0.4124, 0.3576, 0.1805],
+                  [0.2126, 0.7152, 0.0722],
+                  [0.0193, 0.1192, 0.9505]])
+    xyz = c @ m.T / np.array([0.95047, 1.0, 1.08883])
+    f = np.where(xyz > (6 / 29) ** 3, np.cbrt(xyz), xyz / (3 * (6 / 29) ** 2) + 4 / 29)
+    return np.stack([116 * f[..., 1] - 16,
+                     500 * (f[..., 0] - f[..., 1]),
+                     200 * (f[..., 1] - f[..., 2])], axis=-1)
+
+
+def build_lut(swatches: dict) -> np.ndarray:
+    """Color code per RGB555 index (r5 << 10 | g5 << 5 | b5)."""
+    n = 1 << LUT_BITS
+    centre = (np.arange(n) << (8 - LUT_BITS)) + (1 << (7 - LUT_BITS))
+    r, g, b = np.meshgrid(centre, centre, centre, indexing="ij")
+    grid = srgb_to_lab(np.stack([r, g, b], axis=-1).reshape(-1, 3).astype(float))
+    codes = np.array(sorted(swatches))
+    pal = srgb_to_lab(np.array([swatches[k][1] for k in codes], dtype=float))
+    d = ((grid[:, None, :] - pal[None, :, :]) ** 2).sum(axis=-1)
+    return codes[d.argmin(axis=1)].astype(np.uint8)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--swatches", help="JSON file with measured sRGB per color name")
+    args = ap.parse_args()
+
+    swatches = dict(SWATCHES)
+    if args.swatches:
+        with open(args.swatches) as f:
+            measured = json.load(f)
+        for code, (name, _) in SWATCHES.items():
+            if name in measured:
+                swatches[code] = (name, tuple(int(v) for v in measured[name]))
+
+    lut = build_lut(swatches)
+    packed = lut[0::2] | lut[1::2] << 4  # Even index in the low nibble
+
+    out = sys.stdout
+    out.write('#include "PaletteLUT.h"\n\n')
+    out.write("/******************************************************************************\n")
+    out.write(" * Generated by tools/gen_palette_lut.py - do not edit\n")
+    out.write(" * Swatches (sRGB): %s\n" % ", ".join(
+        "%s %d,%d,%d" % ((name,) + rgb) for _, (name, rgb) in sorted(swatches.items())))
+    out.write(" ******************************************************************************/\n")
+    out.write("const uint8_t EPD_PaletteRGB[8][3] = {\n")
+    for code in range(8):
+        name, rgb = swatches.get(code, ("unused", (0, 0, 0)))
+        out.write("    {%3d, %3d, %3d},   // %d %s\n" % (rgb + (code, name)))
+    out.write("};\n\n")
+    out.write("const uint8_t EPD_PaletteLUT[%d] = {\n" % packed.size)
+    for i in range(0, packed.size, 16):
+        out.write("    " + ", ".join("0x%02X" % v for v in packed[i:i + 16]) + ",\n")
+    out.write("};\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())